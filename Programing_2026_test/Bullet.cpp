@@ -13,8 +13,32 @@ Bullet::~Bullet()
 {
 }
 
+void Bullet::Reset(const std::weak_ptr<SceneBase> scene, VECTOR position, float bulletRadiusSize)
+{
+	m_scene = scene;
+	m_isActive = true;
+
+	// O̔˂Őݒ肳ꂽp[^lɖ߂
+	m_baseRadius = bulletRadiusSize;
+	m_moveSpeed = 500.0f;
+	m_direction = { 1.0f, 0.0f, 0.0f };
+	m_lifetime = 5.0f;
+	m_age = 0.0f;
+	m_selfHandle = ObjectHandle();
+	m_outMargin = 16.0f;
+
+	m_transform->SetPosition(position);
+}
+
 void Bullet::InitObject()
 {
+	// F̊liRXgN^͕[EAcquireAsync Ń[J[XbhĂ΂̂ŁADxLib ͂ŌĂԁj
+	// ˑ SetColor ͂̌ɌĂ΂
+	m_bulletColor = GetColor(255, 255, 255);
+
+	// ʒusɔfĂ`iVKEėpʁj
+	m_transform->UpdateMatrix();
+	m_transform->LocalToWorldMatrix();
 	CircleBaseInitUsingTransform(m_baseRadius);
 
 	// RC_[ݒ
@@ -56,7 +80,7 @@ void Bullet::Update()
 	// 
 	m_age += dt;
 	if (m_lifetime > 0.0f && m_age >= m_lifetime) {
-		ObjectManager::GetInstance().Release(m_selfHandle);
+		ObjectManager::GetInstance().ReleaseDeferred(m_selfHandle); // XVȂ̂Ńt[Iɉ
 		return;
 	}
 
@@ -93,8 +117,46 @@ void Bullet::OnHit(Collider* other)
 	// ɓ
 	// (ђʒȅꍇ͂ŏȂ)
 	if (m_selfHandle.IsValid()) {
-		ObjectManager::GetInstance().Release(m_selfHandle);
+		ObjectManager::GetInstance().ReleaseDeferred(m_selfHandle); // Փ˔蒆Ȃ̂Ńt[Iɉ
 	}
 	// RC_[
 	m_collider.SetActive(false);
 }
+
+
+// XibvVbg: ˎɐݒ肳p[^ƃRC_[̏
+void Bullet::Serialize(SnapshotWriter& out) const
+{
+	GameObject::Serialize(out);
+	out.Write(m_baseRadius);
+	out.Write(m_moveSpeed);
+	out.Write(m_direction);
+	out.Write(m_lifetime);
+	out.Write(m_age);
+	out.Write(m_selfHandle.ToUint64());
+	out.Write(m_outMargin);
+	out.Write(m_bulletColor);
+	out.Write(m_collider.IsActive());
+	out.Write(m_collider.GetLayer());
+	out.Write(m_collider.GetMask());
+}
+
+bool Bullet::Deserialize(SnapshotReader& in)
+{
+	uint64_t selfHandle = 0;
+	bool colActive = false;
+	uint32_t layer = 0;
+	uint32_t mask = 0;
+	if (!GameObject::Deserialize(in)) return false;
+	if (!(in.Read(m_baseRadius) && in.Read(m_moveSpeed) && in.Read(m_direction) && in.Read(m_lifetime) && in.Read(m_age)
+		&& in.Read(selfHandle) && in.Read(m_outMargin) && in.Read(m_bulletColor)
+		&& in.Read(colActive) && in.Read(layer) && in.Read(mask))) return false;
+
+	m_selfHandle = ObjectHandle::FromUint64(selfHandle);
+	m_collider.SetRadius(m_baseRadius);
+	m_collider.SetActive(colActive);
+	m_collider.SetLayer(layer);
+	m_collider.SetMask(mask);
+	CircleBaseInitUsingTransform(m_baseRadius);
+	return true;
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include "CircleCollider.h" // ǉ
 #include <memory>
 
-class Bullet
+class Bullet final
 	: public CircleBase
 {
 private:
@@ -17,7 +17,7 @@ private:
 	float m_age = 0.0f;								// oߎԁib)
 	ObjectHandle m_selfHandle;						// ̃nhiZbgj
 	float m_outMargin = 16.0f;						// ʊOp}[WiaȂǂlj
-	unsigned int m_bulletColor = GetColor(255, 255, 255);	// e̐F(ftHg)
+	unsigned int m_bulletColor = 0;					// e̐F(ftHgBDxLib ĂԂ̂ InitObject Őݒ肷)
 
 	// 蔻
 	CircleCollider m_collider;
@@ -27,6 +27,9 @@ public:
 	Bullet(const std::weak_ptr<SceneBase> scene, VECTOR position, float bulletRadiusSize);
 	virtual ~Bullet();
 
+	// v[ėpɐKpiRXgN^Ɠj
+	void Reset(const std::weak_ptr<SceneBase> scene, VECTOR position, float bulletRadiusSize);
+
 	// GameObject CtTCN
 	void InitObject() override;
 	void Start() override;
@@ -34,6 +37,10 @@ public:
 	void Draw() override;
 	void End() override;
 
+	// XibvVbg
+	void Serialize(SnapshotWriter& out) const override;
+	bool Deserialize(SnapshotReader& in) override;
+
 	// ݒ APIiɌĂԁj
 	void SetDirection(const VECTOR& dir); // Kĕۑ
 	void SetSpeed(float speed) { m_moveSpeed = speed; }
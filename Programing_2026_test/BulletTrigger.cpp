@@ -4,7 +4,7 @@
 #include "Time.h"
 #include <cmath>
 
-ObjectHandle BulletTrigger::Shoot(const VECTOR& localOffset, const VECTOR& direction)
+TypedHandle<Bullet> BulletTrigger::Shoot(const VECTOR& localOffset, const VECTOR& direction)
 {
 	const float defaultBulletRadius = 8.0f;
 
@@ -12,7 +12,7 @@ ObjectHandle BulletTrigger::Shoot(const VECTOR& localOffset, const VECTOR& direc
 	std::shared_ptr<GameObject> ownerObj = m_ownerObject.lock();
 	if (!ownerObj) {
 		// I[i[݂Ȃꍇ͒eĂȂiV[ŝ߁j
-		return ObjectHandle(); 
+		return TypedHandle<Bullet>(); 
 	}
 	
 	// I[i[̏V[iColliderManager̔ŏdvj
@@ -71,17 +71,13 @@ ObjectHandle BulletTrigger::Shoot(const VECTOR& localOffset, const VECTOR& direc
 	auto h = ObjectManager::GetInstance().Create<Bullet>(scene, spawnPos, defaultBulletRadius);
 	if (!h.IsValid()) return h;
 
-	//  shared_ptr oăp[^ݒ
+	//  shared_ptr oĔ˃p[^ݒ
+	// iʒuEa͍ėp Bullet::Reset œKpς݁j
 	if (auto b = ObjectManager::GetInstance().Get<Bullet>(h)) {
 		// worldDir 𐳋Kēn
 		b->SetDirection(worldDir);
 		b->SetSelfHandle(h);
 
-		// Transform 𐶐ʒuɊmɔfĂiRXgN^Őݒς݂̂͂m̂߁j
-		b->GetTransform()->SetPosition(spawnPos);
-		b->GetTransform()->UpdateMatrix();
-		b->GetTransform()->LocalToWorldMatrix();
-
 		// ObjectGroup Ƀnĥݓo^iL͂Ȃj
 		m_bullets.Add(h);
 	}
@@ -101,6 +97,11 @@ void BulletTrigger::Draw()
 	m_bullets.DrawAll();
 }
 
+bool BulletTrigger::Deserialize(SnapshotReader& in)
+{
+	return m_bullets.Deserialize(in);
+}
+
 void BulletTrigger::SetOwnerObject(const std::weak_ptr<GameObject>& owner)
 {
 	m_ownerObject = owner; 
@@ -1,14 +1,16 @@
 // Bulletׂ̈̃}l[W[
 #pragma once
-#include "ObjectGroup.h"
+#include "TypedObjectGroup.h"
 #include "ObjectHandle.h"
 #include "Transform.h"
 #include <memory>
 
+class Bullet;
+
 class BulletTrigger
 {
 private:
-	ObjectGroup m_bullets;                      // enh̊ǗiLȂj
+	TypedObjectGroup<Bullet> m_bullets;         // enh̊ǗiLȂBBullet j
 	std::weak_ptr<GameObject> m_ownerObject;    // e GameObjectiLȂj
 	std::weak_ptr<Transform> m_ownerTransform;  // e TransformiLȂj
 
@@ -27,7 +29,7 @@ private:
 public:
 
 	// PˁiKvȃpnj
-	ObjectHandle Shoot(const VECTOR& localOffset, const VECTOR& direction);
+	TypedHandle<Bullet> Shoot(const VECTOR& localOffset, const VECTOR& direction);
 
 	// Update ĂŒeXViScene/Character  Update Ăԁj
 	void Update();
@@ -37,4 +39,8 @@ public:
 	// V[^LIɌĂ
 	void EndAll() { m_bullets.EndAll(); }
 	void Clear()  { m_bullets.Clear(); }
+
+	// XibvVbg: ˍς݂̒ẽnhꗗiL҂ Serialize/Deserialize Ăԁj
+	void Serialize(SnapshotWriter& out) const { m_bullets.Serialize(out); }
+	bool Deserialize(SnapshotReader& in); // Bullet ̌^IDĝ cpp Ŏ
 };
\ No newline at end of file
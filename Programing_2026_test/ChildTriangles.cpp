@@ -31,10 +31,33 @@ ChildTriangles::~ChildTriangles()
 	m_bulletTrigger.Clear();
 }
 
+// v[ėp̈ēKp
+void ChildTriangles::Reset(const std::weak_ptr<SceneBase> scene, VECTOR offset, float triangleRadiusSize)
+{
+	m_scene = scene;
+	m_isActive = true;
+	m_life = 100.0f;
+
+	m_offset = offset;
+	m_offsetSize = std::sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z);
+	m_objectRadius = triangleRadiusSize;
+
+	// O̐eqtOARXgN^Ɠpɖ߂
+	m_transform->ClearParent();
+	m_transform->SetPosition({0.0f,0.0f,0.0f });
+	m_transform->SetRotation({0.0f,0.0f,0.0f });
+	m_transform->SetScale({1.0f,1.0f,1.0f });
+	m_angle =0.0f;
+	m_rotateSpeed =90.0f;
+
+	TriangleBaseInitUsingTransform(m_objectRadius,90.0f);
+}
+
 void ChildTriangles::InitObject()
 {
 	// v[ėp̏
 	m_fireTimer =0.0f;
+	m_bulletColor = GetColor(0, 173, 173); // RXgN^̓[J[XbhœƂ̂ŁADxLib ͂ŌĂ
 
 	// RC_[ݒ
 	m_collider.SetOwner(shared_from_this());
@@ -184,4 +207,33 @@ void ChildTriangles::OnHit(Collider* other)
 {
 	// Oo͂Ȃ
 	m_life -= 10.0f; // 10_[W
+}
+
+// XibvVbg
+void ChildTriangles::Serialize(SnapshotWriter& out) const
+{
+	GameObject::Serialize(out);
+	out.Write(m_life);
+	out.Write(m_offset);
+	out.Write(m_rotateSpeed);
+	out.Write(m_angle);
+	out.Write(m_offsetSize);
+	out.Write(m_objectRadius);
+	out.Write(m_fireTimer);
+	out.Write(m_collider.IsActive());
+	m_bulletTrigger.Serialize(out);
+}
+
+bool ChildTriangles::Deserialize(SnapshotReader& in)
+{
+	bool colActive = false;
+	if (!GameObject::Deserialize(in)) return false;
+	if (!(in.Read(m_life) && in.Read(m_offset) && in.Read(m_rotateSpeed) && in.Read(m_angle)
+		&& in.Read(m_offsetSize) && in.Read(m_objectRadius) && in.Read(m_fireTimer) && in.Read(colActive))) return false;
+	if (!m_bulletTrigger.Deserialize(in)) return false;
+
+	// e Transform ւ̕t͐eiTrianglesj Deserialize ōs
+	m_collider.SetActive(colActive);
+	TriangleBaseInitUsingTransform(m_objectRadius, 90.0f);
+	return true;
 }
\ No newline at end of file
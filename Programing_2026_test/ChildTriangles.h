@@ -3,7 +3,7 @@
 #include "BulletTrigger.h"
 #include "TriangleCollider.h"
 
-class ChildTriangles
+class ChildTriangles final
 	: public TriangleBase
 {
 private:
@@ -26,7 +26,7 @@ private:
 	float m_bulletRadius = 3.0f;	// e̔a (px/scale=1)
 	float m_bulletSpeed = 100.0f;	// ȇx (px/sec)
 	float m_bulletLife = 10.0f;		// e̎ (b)
-	unsigned int m_bulletColor = GetColor(0, 173, 173); // e̐F(VAn)
+	unsigned int m_bulletColor = 0; // e̐F(VAnBDxLib ĂԂ̂ InitObject Őݒ肷)
 
 	// 蔻p
 	TriangleCollider m_collider;
@@ -35,6 +35,9 @@ public:
 	ChildTriangles(const std::weak_ptr<SceneBase> scene, VECTOR offset, float triangleRadiusSize);
 	virtual ~ChildTriangles();
 
+	// v[ėpɐKpiRXgN^Ɠj
+	void Reset(const std::weak_ptr<SceneBase> scene, VECTOR offset, float triangleRadiusSize);
+
 public:
 	void InitObject() override;	// ǉ: tbNiɌĂтhNXŎj
 	void Start() override;		// ŏɈ񂾂Ă΂
@@ -42,6 +45,10 @@ public:
 	void Draw() override;		// t[Ă΂i`pj
 	void End() override;        // V[폜ƂɈ񂾂Ă΂
 
+	// XibvVbg
+	void Serialize(SnapshotWriter& out) const override;
+	bool Deserialize(SnapshotReader& in) override;
+
 private:
 	void Move(); // ړ(Class)
 
@@ -16,13 +16,31 @@ ColliderManager& ColliderManager::GetInstance()
 void ColliderManager::Register(Collider* collider)
 {
     if (!collider) return;
-    m_colliders.push_back(collider);
+    std::lock_guard<std::mutex> lk(m_pendingMutex);
+    m_pendingColliders.push_back(collider);
+}
+
+void ColliderManager::FlushPendingRegisters()
+{
+    std::lock_guard<std::mutex> lk(m_pendingMutex);
+    m_colliders.insert(m_colliders.end(), m_pendingColliders.begin(), m_pendingColliders.end());
+    m_pendingColliders.clear();
 }
 
 void ColliderManager::Unregister(Collider* collider)
 {
     if (!collider) return;
 
+    // o^҂̂܂܂ȂAOł悢iՓˏ͂܂j
+    {
+        std::lock_guard<std::mutex> lk(m_pendingMutex);
+        auto pendingIt = std::find(m_pendingColliders.begin(), m_pendingColliders.end(), collider);
+        if (pendingIt != m_pendingColliders.end()) {
+            m_pendingColliders.erase(pendingIt);
+            return;
+        }
+    }
+
     // Xg폜
     auto it = std::find(m_colliders.begin(), m_colliders.end(), collider);
     if (it != m_colliders.end()) {
@@ -63,6 +81,9 @@ void ColliderManager::Execute()
     auto currentScene = SceneBase::GetCurrentSceneWeak().lock();
     if (!currentScene) return; // V[Δ肵Ȃ
 
+    // O Execute ȍ~ɓo^ꂽRC_[
+    FlushPendingRegisters();
+
     size_t count = m_colliders.size();
     
     // ݂̃t[ł̏Փ˃yAۑZbg
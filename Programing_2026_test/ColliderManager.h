@@ -3,6 +3,7 @@
 #include <memory>
 #include <set>      // ǉ
 #include <utility>  // ǉ for std::pair
+#include <mutex>
 #include "Collider.h"
 
 // O錾
@@ -15,6 +16,8 @@ public:
     static ColliderManager& GetInstance();
 
     // RC_[̓o^E
+    // o^͈UۗXgɐς݁A Execute ̐擪ŊǗXgֈڂ
+    // iObjectPool ̃[J[XbhŃIuWFNg𐶐ƂRXgN^Ă΂邽߁j
     void Register(Collider* collider);
     void Unregister(Collider* collider);
 
@@ -41,8 +44,13 @@ private:
     // ⏕֐
     float GetPointLineDistSq(const VECTOR& p, const VECTOR& a, const VECTOR& b);
 
+    // ۗ̓o^ǗXgֈڂ
+    void FlushPendingRegisters();
+
 private:
     std::vector<Collider*> m_colliders; // ǗXg
+    std::vector<Collider*> m_pendingColliders; // o^҂im_pendingMutex ŕیj
+    std::mutex m_pendingMutex; // o^҂Xgp~[ebNX
 
     // ǉ: Ot[̏Փ˃yA (Collider|C^̃yAB first < second ŕۑ)
     std::set<std::pair<Collider*, Collider*>> m_prevCollisions;
@@ -3,6 +3,8 @@
 #include <type_traits>
 #include "GameObject.h"
 #include "Assert.h"
+#include "ObjectArena.h"
+#include <atomic>
 
 class Factory
 {
@@ -17,15 +19,28 @@ private:
 	Factory& operator=(const Factory&) = delete;
 
 public:
+	// A[i[h̐؂ւiLȂ^Ƃ̘Ä悩mۂBNɐݒ肷j
+	// jIuWFNg̃̓`NiObjectArena::BlocksPerChunk j̑SubN󂢂Ƃ OS ֕Ԃ
+	void SetArenaMode(bool enabled) { m_arenaMode.store(enabled, std::memory_order_relaxed); }
+	bool IsArenaMode() const { return m_arenaMode.load(std::memory_order_relaxed); }
+
 	// CreateObject: IuWFNg𐶐ĕԂi͌Ăяoōsj
 	template <typename T, typename... Args>
 	std::shared_ptr<T> CreateObject(Args&&... args)
 	{
 		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
 
+		// A[i[h: ^Ƃ̃`NɕׂĊmہiubNubNɓj
+		if (IsArenaMode()) {
+			return std::allocate_shared<T>(ArenaAllocator<T>(), std::forward<Args>(args)...);
+		}
+
 		// make_sharedŐi͌Ăяoōsj
 		auto obj = std::make_shared<T>(std::forward<Args>(args)...);
 
 		return obj;
 	}
+
+private:
+	std::atomic<bool> m_arenaMode{ false }; // A[i[h
 };
\ No newline at end of file
@@ -61,3 +61,17 @@ void GameObject::Draw() {}
 // V[폜ƂɈ񂾂Ă΂
 void GameObject::End() {}
 
+// XibvVbg: NX̏ԁiOEqXgEV[͕ۑȂj
+void GameObject::Serialize(SnapshotWriter& out) const
+{
+	out.Write(m_tag);
+	out.Write(m_layer);
+	out.Write(m_id);
+	out.Write(m_isActive);
+}
+
+bool GameObject::Deserialize(SnapshotReader& in)
+{
+	return in.Read(m_tag) && in.Read(m_layer) && in.Read(m_id) && in.Read(m_isActive);
+}
+
@@ -1,5 +1,6 @@
 #pragma once
 #include "Transform.h"
+#include "SnapshotIO.h"
 #include <vector>
 #include <memory>
 #include <string>
@@ -36,6 +37,12 @@ public:
 	virtual void Draw();		// t[Ă΂i`pj
 	virtual void End();        // V[폜ƂɈ񂾂Ă΂
 
+public: // XibvVbgiObjectManager::Snapshot/Restorej
+	// ^Ƃ̏ԂoiTransform ̓v[ŕۑ̂ŕsvBhNX͊ɌĂԁj
+	virtual void Serialize(SnapshotWriter& out) const;
+	// Serialize ŏɓǂݖ߂i̍ŌɌĂ΂̂ŁA`RC_[ȂǔhԂō蒼j
+	virtual bool Deserialize(SnapshotReader& in);
+
 public: // Qb^[
 	std::shared_ptr<Transform> GetTransform() { return m_transform; } // Transform̎擾
 	// m_scene ̃Qb^[ 
@@ -1,6 +1,11 @@
 #include "LoadScene.h"
 #include "MainGameScene.h"
 #include "DxLib.h"
+#include "ObjectManager.h"
+#include "Bullet.h"
+#include "ChildTriangles.h"
+#include "Player.h"
+#include "Triangles.h"
 
 LoadScene::LoadScene()
 {
@@ -14,7 +19,24 @@ LoadScene::~LoadScene()
 
 void LoadScene::Start()
 {
-
+	// Q[ɎgIuWFNgv[֎OĂi͑O܂ł̃vt@C猈߂j
+	// ͎擾 Reset œKp̂ŉ̒lł悢iscene ̓V[ؑ֎ɍXVj
+	auto currentSceneWeak = SceneBase::GetCurrentSceneWeak();
+	ObjectManager::GetInstance().RegisterType<Bullet>(m_reserveBulletCount, currentSceneWeak, VGet(0.0f, 0.0f, 0.0f), 3.0f);
+	ObjectManager::GetInstance().RegisterType<ChildTriangles>(m_reserveChildCount, currentSceneWeak, VGet(0.0f, 0.0f, 0.0f), 20.0f);
+	// vC[ƓG{͎̂OȂARestore ō蒼悤ɐo^Ă
+	ObjectManager::GetInstance().RegisterType<Player>(0, currentSceneWeak, VGet(0.0f, 0.0f, 0.0f), 20.0f);
+	ObjectManager::GetInstance().RegisterType<Triangles>(0, currentSceneWeak, VGet(0.0f, 0.0f, 0.0f), 35.0f);
+	ObjectManager::GetInstance().ReserveProfiled();
+
+	// e̐ɏ݂ȉȂłgpʂǂ߂悤ɁBł͍łÂeg񂷁j
+	ObjectPool::Budget bulletBudget;
+	bulletBudget.maxCount = m_maxBulletCount;
+	bulletBudget.policy = ObjectPool::CapPolicy::RecycleOldest;
+	ObjectManager::GetInstance().SetTypeBudget<Bullet>(bulletBudget);
+
+	// e̓Q[ɑʂɏo肷̂ŁAҋ@烏[J[Xbhŕ[Ăi擾̐Ŏ~܂Ȃ悤Ɂj
+	ObjectManager::GetInstance().SetRefill<Bullet>(m_refillBulletLowWater, m_reserveBulletCount);
 }
 
 void LoadScene::End()
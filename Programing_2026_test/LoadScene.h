@@ -9,6 +9,12 @@ private:
 	float m_loadTime = 2;  // [hɂ鎞(b)
 	float m_loadTimer = 0; // [hԌvp^C}[
 
+	// v[̎Oivt@CɋL^NɎgj
+	size_t m_reserveBulletCount = 128;	// eivC[EG̓ː̖ڈj
+	size_t m_reserveChildCount = 4;		// G̎qIuWFNgiTriangles 1̂ɂ4j
+	size_t m_refillBulletLowWater = 32;	// ȇҋ@[
+	size_t m_maxBulletCount = 2048;		// ȅiłÂeg񂷁j
+
 public:
 	LoadScene();
 	virtual ~LoadScene();
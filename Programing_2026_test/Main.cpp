@@ -3,6 +3,8 @@
 #include "SceneBase.h"
 #include "TitleScene.h"
 #include "ObjectManager.h"
+#include "Factory.h"
+#include "PoolBenchmark.h"
 #include <chrono>
 #include <memory>
 
@@ -19,6 +21,28 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		return -1;
 	}
 
+	// v[̃IuWFNg^Ƃ̘Ä悩mۂ
+	Factory::GetInstance().SetArenaMode(true);
+
+	// O܂ł̃v[gp̃vt@CǂݍށiI ClearAll ŏ߂j
+	ObjectManager::GetInstance().LoadProfile("PoolProfile.bin");
+
+	// ěȂǂőXbǵAV[ؑ֎Ɩ5bȂƂɖl߂
+	ObjectManager::GetInstance().SetAutoCompact(true, 300);
+
+#ifdef _DEBUG
+	// fobOrh擾ԂviPoolStats.csv ̃qXgOB[Xł͉񐔂j
+	ObjectManager::GetInstance().SetTelemetryEnabled(true);
+#endif // _DEBUG
+
+#ifdef POOL_BENCHMARK
+	// vprh: Q[͋NAv[̐\vsďIiʂ PoolBenchmark.csvj
+	PoolBenchmark::Run("PoolBenchmark.csv");
+	ObjectManager::GetInstance().ClearAll();
+	DxLib_End();
+	return 0;
+#endif // POOL_BENCHMARK
+
 	// V[ shared_ptrŊǗishared_from_this g悤ɂj
 	std::shared_ptr<SceneBase> pRootScene = std::make_shared<TitleScene>();
 	// ObjectManager oRŏV[o^
@@ -29,6 +53,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	SetDrawScreen(DX_SCREEN_BACK);
 
 	double cleanupInterval =10.0; // `FbNԊu
+	size_t cleanupSlotsPerFrame =64; // 1t[Œׂҋ@Xbg̏
+	double cleanupMicrosPerFrame =200.0; // 1t[ŎgN[AbvԂ̏i}CNbj
 
 	// C[v
 	while (CheckHitKey(KEY_INPUT_ESCAPE) ==0 && ProcessMessage() ==0)
@@ -39,6 +65,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		Time::GetInstance().Update();
 		double dt = Time::GetInstance().DeltaTime();
 
+		// v[̃t[i߂iAChԂ͂̃t[ԍ dt ̗݌vŌvj
+		ObjectManager::GetInstance().AdvanceFrame(dt);
+
 		// V[XVFUpdate  shared_ptr Ԃ
 		auto nextPtr = pRootScene->Update();
 		if (nextPtr.get() != pRootScene.get())
@@ -50,8 +79,11 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 			pRootScene->Start();
 		}
 
+		// XVɗ\񂳂ꂽ܂Ƃ߂Ďsit[̋؂j
+		ObjectManager::GetInstance().FlushReleases();
+
 		// IuWFNgv[̃N[Abv
-		size_t removed = ObjectManager::GetInstance().CleanupIdle(cleanupInterval);
+		size_t removed = ObjectManager::GetInstance().CleanupIdleStep(cleanupInterval, cleanupSlotsPerFrame, cleanupMicrosPerFrame);
 
 		// `
 		pRootScene->Draw();
@@ -65,6 +97,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	// I
 	if (pRootScene) { pRootScene->End(); pRootScene.reset(); }
 
+	// ̃ZbṼv[voiOE[ݒ̌Ɏgj
+	ObjectManager::GetInstance().DumpStatsCsv("PoolStats.csv");
+
 	// IuWFNg}l[W̉
 	ObjectManager::GetInstance().ClearAll();
 
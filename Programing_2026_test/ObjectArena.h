@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// ^Ƃ̌ŒTCYubN̈iA[ij
+// ^̃IuWFNg`NPʂ̘ÄɕׁA1Ƃ malloc Ȃ
+// ubÑAhX͉܂œȂBSubN󂢂`N̓ԂiSpareChunks ܂ł͎cj
+template <typename T>
+class ObjectArena
+{
+public:
+	static const size_t BlocksPerChunk = 256; // 1`ÑubN
+	static const size_t SpareChunks = 1; // 󂢂ĂɎc`NiEŊmۂƉJԂȂ߁j
+
+	// CX^X擾
+	// IuWFNg̔jÓIϐ̔jɂȂĂg悤AӐ}IɉȂ
+	static ObjectArena& GetInstance()
+	{
+		static ObjectArena* instance = new ObjectArena();
+		return *instance;
+	}
+
+	// ubN1mۂiAhX̏`N疄߂B󂫂΃`Nǉj
+	void* Allocate()
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		size_t i = m_firstFree;
+		while (i < m_chunks.size() && m_chunks[i].freeBlocks.empty()) ++i;
+		if (i == m_chunks.size()) i = AddChunk_NoLock();
+		m_firstFree = i;
+
+		Chunk& chunk = m_chunks[i];
+		if (chunk.freeBlocks.size() == BlocksPerChunk) --m_emptyChunks;
+		Block* block = chunk.freeBlocks.back();
+		chunk.freeBlocks.pop_back();
+		return block;
+	}
+
+	// ubNԋpi`N̑SubN󂫁A\̃`Nɂ΃`NƉj
+	void Deallocate(void* p)
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		Block* block = static_cast<Block*>(p);
+		const size_t i = FindChunk_NoLock(block);
+		Chunk& chunk = m_chunks[i];
+		chunk.freeBlocks.push_back(block);
+		if (i < m_firstFree) m_firstFree = i;
+		if (chunk.freeBlocks.size() < BlocksPerChunk) return;
+
+		if (m_emptyChunks < SpareChunks) {
+			++m_emptyChunks;
+			return;
+		}
+		m_chunks.erase(m_chunks.begin() + i); // m_firstFree  i ȉȂ̂ŁÂ܂܂Ō̃`Nw
+	}
+
+	// mۍς݂̃`NifobOpj
+	size_t ChunkCount() const
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		return m_chunks.size();
+	}
+
+private:
+	using Block = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	// `NiÄjƁA̒̋󂫃ubN
+	struct Chunk
+	{
+		std::unique_ptr<Block[]> blocks;
+		std::vector<Block*> freeBlocks;
+	};
+
+	ObjectArena() = default;
+	ObjectArena(const ObjectArena&) = delete;
+	ObjectArena& operator=(const ObjectArena&) = delete;
+
+	// `NǉiAhẌʒuɓÄʒuԂj
+	size_t AddChunk_NoLock()
+	{
+		Chunk chunk;
+		chunk.blocks.reset(new Block[BlocksPerChunk]);
+
+		// 擪̃ubN珇Ɏg悤Aς
+		chunk.freeBlocks.reserve(BlocksPerChunk);
+		for (size_t i = BlocksPerChunk; i > 0; --i) {
+			chunk.freeBlocks.push_back(&chunk.blocks[i - 1]);
+		}
+
+		const auto it = std::upper_bound(m_chunks.begin(), m_chunks.end(), chunk.blocks.get(),
+			[](const Block* p, const Chunk& c) { return std::less<const Block*>()(p, c.blocks.get()); });
+		const size_t index = static_cast<size_t>(it - m_chunks.begin());
+		m_chunks.insert(it, std::move(chunk));
+		++m_emptyChunks;
+		return index;
+	}
+
+	// ubN܂ރ`N̈ʒui`N̓AhXɕłj
+	size_t FindChunk_NoLock(const Block* block) const
+	{
+		const auto it = std::upper_bound(m_chunks.begin(), m_chunks.end(), block,
+			[](const Block* p, const Chunk& c) { return std::less<const Block*>()(p, c.blocks.get()); });
+		return static_cast<size_t>(it - m_chunks.begin()) - 1;
+	}
+
+private:
+	mutable std::mutex m_mutex;
+	std::vector<Chunk> m_chunks; // `Ni擪AhX̏j
+	size_t m_firstFree = 0; // Õ`Nɂ͋󂫃ubN
+	size_t m_emptyChunks = 0; // SubN󂢂Ă`N̐
+};
+
+// std::allocate_shared p̃AP[^
+// ubNƃIuWFNg܂Ƃ߂^ rebind ̂ŁǍ^Ƃ̃A[imۂ
+template <typename T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	ArenaAllocator() noexcept {}
+	template <typename U>
+	ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		if (n != 1) return static_cast<T*>(::operator new(n * sizeof(T))); // zmۂ̓A[igȂ
+		return static_cast<T*>(ObjectArena<T>::GetInstance().Allocate());
+	}
+
+	void deallocate(T* p, size_t n) noexcept
+	{
+		if (n != 1) { ::operator delete(p); return; }
+		ObjectArena<T>::GetInstance().Deallocate(p);
+	}
+
+	template <typename U>
+	bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+	template <typename U>
+	bool operator!=(const ArenaAllocator<U>&) const noexcept { return false; }
+};
\ No newline at end of file
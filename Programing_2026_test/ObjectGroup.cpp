@@ -1,5 +1,6 @@
 #include "ObjectGroup.h"
 #include "ObjectManager.h"
+#include "Assert.h"
 #include "DxLib.h"
 
 // fobOo͂fobOrĥ݂Ɍ肷}N
@@ -11,6 +12,7 @@
 
 // nhǉinh͖j
 // ǉɑΉ GameObject  Start() xĂԂ悤ɕύX
+// ɒǉꂽnh́ȂIĂтɓȋł͉Ȃj
 void ObjectGroup::Add(ObjectHandle h)
 {
 	if (!h.IsValid()) return;
@@ -18,173 +20,146 @@ void ObjectGroup::Add(ObjectHandle h)
 	{
 		// Rei͒ZԂbN
 		std::lock_guard<std::mutex> lk(m_mutex);
-		m_handles.push_back(h);
+		if (m_iterating > 0) m_pendingAdds.push_back(h);
+		else AddEntry_NoLock(h);
 	}
 
 	// Start ̌Ăяo̓bNOōsiēfbhbNj
-	auto obj = ObjectManager::GetInstance().GetRaw(h);
+	auto& mgr = ObjectManager::GetInstance();
+	auto obj = mgr.PinRaw(h);
 	if (obj) {
 		obj->Start();
 	}
+	else if (mgr.IsPending(h)) {
+		// ҂͂܂̂̂ŁAi[ꂽ UpdateAll ŌĂ
+		std::lock_guard<std::mutex> lk(m_mutex);
+		m_awaitingStart.push_back(h);
+	}
 }
 
 // nh폜i݂΁j
+// ʒu̕\ň̂ O(1)BUnordered ͖̗vfƓւĊOAStable ͕WɂĎ̑̏Iɋl߂
+// ͕тςȂ̂ŕۗāȀIɔf
 void ObjectGroup::Remove(ObjectHandle h)
 {
+	if (!h.IsValid()) return;
 	std::lock_guard<std::mutex> lk(m_mutex);
-	auto it = std::remove(m_handles.begin(), m_handles.end(), h);
-	if (it != m_handles.end()) m_handles.erase(it, m_handles.end());
+	if (!m_awaitingStart.empty()) {
+		auto awaiting = std::find(m_awaitingStart.begin(), m_awaitingStart.end(), h);
+		if (awaiting != m_awaitingStart.end()) m_awaitingStart.erase(awaiting);
+	}
+	if (m_iterating > 0) {
+		// ̒Œǉꂽ̂ȂAۗ̒ǉOł悢
+		auto added = std::find(m_pendingAdds.begin(), m_pendingAdds.end(), h);
+		if (added != m_pendingAdds.end()) m_pendingAdds.erase(added);
+		else m_pendingRemoves.push_back(h);
+		return;
+	}
+
+	const uint32_t pos = PositionOf_NoLock(h.index);
+	if (pos == NoPosition || m_handles[pos] != h) return; // ĂȂi܂͕ʂ̐j
+
+	if (m_order == Order::Stable) Tombstone_NoLock(pos); // W͑Ŕ΂̂ŁAʂ͂̂܂܎g
+	else SwapPop_NoLock(pos);
 }
 
 // SNA
 void ObjectGroup::Clear()
 {
-	// XibvVbgăbN  Release bNOōs
-	std::vector<ObjectHandle> snapshot;
+	// nhoăbN  Release bNOōs
+	std::vector<ObjectHandle> released;
 	{
 		std::lock_guard<std::mutex> lk(m_mutex);
-		snapshot = m_handles;
-		m_handles.clear();
+		if (m_iterating > 0) {
+			// ͕тςȂ̂ŁAIƂɋɂ
+			released = m_handles;
+			m_clearOnEnd = true;
+		}
+		else {
+			released = m_handles;
+			ResetEntries_NoLock();
+		}
+		released.insert(released.end(), m_pendingAdds.begin(), m_pendingAdds.end());
+		m_pendingAdds.clear();
+		m_pendingRemoves.clear();
 	}
 
-	// XibvVbgg Release Ă
+	// onhg Release Ă
 	auto& mgr = ObjectManager::GetInstance();
-	for (auto h : snapshot) {
-		if (h.IsValid()) {	// nh͖
+	for (auto h : released) {
+		if (h.IsValid()) {	// nhiWj͖
 			mgr.Release(h); // bNOŌĂ
 		}
 	}
 }
 
 // SIuWFNg Updateinh̓Xg폜j
-// m_handles ̒ڃCe[V͔AZԂŃXibvVbg
+// m_handles ̏ŉ񂷁i̒ǉE폜͏Iɂ܂Ƃ߂Ĕf̂ŁAvf͕ςȂj
 void ObjectGroup::UpdateAll()
 {
-	auto& mgr = ObjectManager::GetInstance(); // IuWFNg}l[W擾
-
-	// XibvVbg擾iZԂbNj
-	std::vector<ObjectHandle> snapshot;
-	{
-		std::lock_guard<std::mutex> lk(m_mutex);
-		snapshot = m_handles;
-	}
-
-	// XibvVbgŏBȃnh͍폜tOɂ
-	bool modified = false;
-	std::vector<ObjectHandle> newList;
-	newList.reserve(snapshot.size());
+	StartCommitted();
 
 	// eIuWFNgɑ΂ Update Ă
-	for (auto handle : snapshot)
+	VisitResolved([](ObjectHandle handle, GameObject& obj)
 	{
-		auto obj = mgr.GetRaw(handle);
-		if (obj)
-		{
-			// fobOo
-			OG_DEBUG_PRINTF("[ObjectGroup] UpdateAll handle idx=%u gen=%u ptr=%p use_count=%d\n",
-					handle.index, handle.generation, obj.get(), static_cast<int>(obj.use_count()));
-
-			if (obj.get() == nullptr || obj.use_count() <= 0)
-			{
-				//  -> omit from new list
-				modified = true;
-				continue;
-			}
-
-			// Update ĂԁibNOj
-			obj->Update();
-			newList.push_back(handle);
-		}
-		else
-		{
-			// ς -> omit
-			modified = true;
-		}
-	}
+		// fobOo
+		OG_DEBUG_PRINTF("[ObjectGroup] UpdateAll handle idx=%u gen=%u ptr=%p\n",
+				handle.index, handle.generation, &obj);
 
-	// ReiύXꂽuiZԃbNj
-	if (modified)
-	{
-		std::lock_guard<std::mutex> lk(m_mutex);
-		m_handles = std::move(newList);
-	}
+		// Update ĂԁibNOj
+		obj.Update();
+	});
 }
 
-// `piXibvVbgj
+// `piUpdateAll Ɠ̏ŉ񂷁BUpdateAll ŉʂg񂵁ǍɉΉj
 void ObjectGroup::DrawAll()
 {
-	auto& mgr = ObjectManager::GetInstance(); // IuWFNg}l[W擾
-
-	// XibvVbg擾iZԂbNj
-	std::vector<ObjectHandle> snapshot;
-	{
-		std::lock_guard<std::mutex> lk(m_mutex);
-		snapshot = m_handles;
-	}
-
-	bool modified = false;
-	std::vector<ObjectHandle> newList;
-	newList.reserve(snapshot.size());
-
 	// eIuWFNgɑ΂ Draw Ă
-	for (auto handle : snapshot)
+	VisitResolved([](ObjectHandle handle, GameObject& obj)
 	{
-		auto obj = mgr.GetRaw(handle);
-		if (obj)
-		{
-			// fobOo
-			OG_DEBUG_PRINTF("[ObjectGroup] DrawAll handle idx=%u gen=%u ptr=%p use_count=%d\n",
-					handle.index, handle.generation, obj.get(), static_cast<int>(obj.use_count()));
-
-			if (obj.get() == nullptr || obj.use_count() <= 0)
-			{
-				modified = true;
-				continue;
-			}
-
-			obj->Draw();
-			newList.push_back(handle);
-		}
-		else
-		{
-			modified = true;
-		}
-	}
+		// fobOo
+		OG_DEBUG_PRINTF("[ObjectGroup] DrawAll handle idx=%u gen=%u ptr=%p\n",
+				handle.index, handle.generation, &obj);
 
-	if (modified) // ReiύXꂽu
-	{
-		// ZԃbN
-		std::lock_guard<std::mutex> lk(m_mutex);
-		m_handles = std::move(newList);
-	}
+		obj.Draw();
+	});
 }
 
 // SIuWFNg End
 void ObjectGroup::EndAll()
 {
-	// XibvVbg擾iZԃbNj
-	std::vector<ObjectHandle> snapshot;
+	// nhoiZԃbNBNAɍsj
+	std::vector<ObjectHandle> handles;
 	{
 		std::lock_guard<std::mutex> lk(m_mutex);
-		snapshot = m_handles;
-		// NAɍs
-		m_handles.clear();
+		if (m_iterating > 0) {
+			handles = m_handles;
+			m_clearOnEnd = true;
+		}
+		else {
+			handles = m_handles;
+			ResetEntries_NoLock();
+		}
+		handles.insert(handles.end(), m_pendingAdds.begin(), m_pendingAdds.end());
+		m_pendingAdds.clear();
+		m_pendingRemoves.clear();
 	}
 
 	auto& mgr = ObjectManager::GetInstance();
 
 	// 1) ܂ End ĂԁibNOj
-	std::vector<std::shared_ptr<GameObject>> strongRefs;
-	strongRefs.reserve(snapshot.size());
-	for (auto h : snapshot) {
+	// End ɑ̃IuWFNgĂAv[͎̃t[܂Ŏ̂jȂ̂ FramePin ̂܂܂ł悢
+	std::vector<FramePin<GameObject>> pins;
+	pins.reserve(handles.size());
+	for (auto h : handles) {
 		if (!h.IsValid()) continue;
-		if (auto obj = mgr.GetRaw(h)) {
-			strongRefs.push_back(obj);
+		if (auto obj = mgr.PinRaw(h)) {
+			pins.push_back(obj);
 		}
 	}
 
 	// End Ăяo
-	for (auto& obj : strongRefs) {
+	for (auto& obj : pins) {
 		try {
 			obj->End();
 		}
@@ -197,7 +172,7 @@ void ObjectGroup::EndAll()
 	}
 
 	// End ĂяInh}l[W Release ăv[֖߂ibNOj
-	for (auto h : snapshot) {
+	for (auto h : handles) {
 		if (h.IsValid()) {
 			mgr.Release(h);
 		}
@@ -208,78 +183,265 @@ void ObjectGroup::EndAll()
 void ObjectGroup::ForEach(const std::function<void(std::shared_ptr<GameObject>)>& func)
 {
 	auto& mgr = ObjectManager::GetInstance(); // IuWFNg}l[W擾
-
-	// XibvVbg擾iZԂbNj
-	std::vector<ObjectHandle> snapshot;
-	{
-		std::lock_guard<std::mutex> lk(m_mutex);
-		snapshot = m_handles;
-	}
-
-	bool modified = false;
-	std::vector<ObjectHandle> newList;
-	newList.reserve(snapshot.size());
+	IterationScope scope(*this);
 
 	// eIuWFNgɑ΂ func Ă
-	for (auto handle : snapshot)
+	for (size_t i = 0; i < m_handles.size(); ++i)
 	{
+		const ObjectHandle handle = m_handles[i];
+		if (!handle.IsValid()) continue;
+
 		auto obj = mgr.GetRaw(handle);
-		if (obj)
+		if (!obj)
 		{
-			// fobOo 
-			OG_DEBUG_PRINTF("[ObjectGroup] ForEach handle idx=%u gen=%u ptr=%p use_count=%d\n",
-					handle.index, handle.generation, obj.get(), static_cast<int>(obj.use_count()));
-
-			if (obj.get() == nullptr || obj.use_count() <= 0)
-			{
-				modified = true;
-				continue;
-			}
-
-			func(obj);
-			newList.push_back(handle);
+			MarkDead(i);
+			continue;
 		}
-		else
-		{
-			modified = true;
+
+		// fobOo 
+		OG_DEBUG_PRINTF("[ObjectGroup] ForEach handle idx=%u gen=%u ptr=%p use_count=%d\n",
+				handle.index, handle.generation, obj.get(), static_cast<int>(obj.use_count()));
+
+		func(obj);
+	}
+}
+
+void ObjectGroup::BeginIteration()
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	// ̏݁iWEʁj̓bNȂ̂ŁAʃXbh瓯ɑĂ͂Ȃ
+	ASSERT_MSG(m_iterating == 0 || m_iteratingThread == std::this_thread::get_id(),
+		"ObjectGroup: iterated from two threads at once");
+	if (m_iterating == 0) m_iteratingThread = std::this_thread::get_id();
+	++m_iterating;
+}
+
+void ObjectGroup::EndIteration()
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	if (--m_iterating == 0) {
+		ApplyPending_NoLock();
+	}
+}
+
+void ObjectGroup::MarkDead(size_t index)
+{
+	// ̂1̃XbhŁÅԂ͑̃Xbh m_handlesEm_positions ύXȂiAdd/Remove ͕ۗĵŁAbNŏĂ悢
+	Tombstone_NoLock(index);
+}
+
+void ObjectGroup::ApplyPending_NoLock()
+{
+	if (m_clearOnEnd) {
+		ResetEntries_NoLock();
+		m_clearOnEnd = false;
+	}
+
+	// ɍ폜ꂽnhWɂiʒu̕\ňj
+	for (auto h : m_pendingRemoves) {
+		const uint32_t pos = PositionOf_NoLock(h.index);
+		if (pos != NoPosition && m_handles[pos] == h) Tombstone_NoLock(pos);
+	}
+	m_pendingRemoves.clear(); // clear ͗eʂĉŁÃt[ŊmۂȂ
+
+	// Wl߂
+	CompactTombstones_NoLock();
+
+	// ɒǉꂽnh𖖔ɉ
+	for (auto h : m_pendingAdds) {
+		AddEntry_NoLock(h);
+	}
+	m_pendingAdds.clear();
+}
+
+uint32_t ObjectGroup::PositionOf_NoLock(uint32_t index) const
+{
+	return index < m_positions.size() ? m_positions[index] : NoPosition;
+}
+
+void ObjectGroup::AddEntry_NoLock(ObjectHandle h)
+{
+	const uint32_t pos = PositionOf_NoLock(h.index);
+	if (pos != NoPosition) {
+		if (m_handles[pos] == h) return; // do^͂Ȃ
+
+		// XbǧÂオcĂiς݂ŁA܂ŊOĂȂj
+		if (m_order == Order::Unordered) {
+			// ۂȂĂ悢̂ŁÄʒû܂܎g
+			m_handles[pos] = h;
+			m_resolvedDirty = true;
+			return;
 		}
+		Tombstone_NoLock(pos); // ۂꍇ͌ÂWɂāAV͖ɉ
 	}
 
-	// ReiύXꂽuiZԃbNj
-	if (modified)
-	{
-		std::lock_guard<std::mutex> lk(m_mutex);
-		m_handles = std::move(newList);
+	if (h.index >= m_positions.size()) m_positions.resize(h.index + 1, static_cast<uint32_t>(NoPosition)); // resize ͎QƂŎ󂯂̂Œlɂēn
+	m_positions[h.index] = static_cast<uint32_t>(m_handles.size());
+	m_handles.push_back(h);
+	m_resolvedDirty = true;
+}
+
+void ObjectGroup::Tombstone_NoLock(size_t pos)
+{
+	ObjectHandle& handle = m_handles[pos];
+	if (!handle.IsValid()) return; // W
+	m_positions[handle.index] = NoPosition;
+	handle = ObjectHandle();
+	m_deadPositions.push_back(static_cast<uint32_t>(pos));
+}
+
+void ObjectGroup::SwapPop_NoLock(size_t pos)
+{
+	if (m_handles[pos].IsValid()) m_positions[m_handles[pos].index] = NoPosition;
+
+	// ʂ悤ɓĂ΁AɎg
+	const bool mirrorResolved = m_resolved.size() == m_handles.size();
+	const size_t last = m_handles.size() - 1;
+	if (pos != last) {
+		m_handles[pos] = m_handles[last];
+		if (m_handles[pos].IsValid()) m_positions[m_handles[pos].index] = static_cast<uint32_t>(pos);
+		if (mirrorResolved) m_resolved[pos] = m_resolved[last];
 	}
+	m_handles.pop_back();
+	if (mirrorResolved) m_resolved.pop_back();
 }
 
-// qIuWFNg폜
-void ObjectGroup::RemoveAllChild()
+void ObjectGroup::CompactTombstones_NoLock()
 {
-	auto& mgr = ObjectManager::GetInstance(); // IuWFNg}l[W擾
-	// XibvVbg擾iZԃbNj
-	std::vector<ObjectHandle> snapshot;
+	if (m_deadPositions.empty()) return;
+
+	if (m_order == Order::Unordered) {
+		// ̈ʒuOi̕W͂OĂ̂ŁAڂĂ̂͐Ăvfj
+		std::sort(m_deadPositions.begin(), m_deadPositions.end(), std::greater<uint32_t>());
+		for (uint32_t pos : m_deadPositions) {
+			SwapPop_NoLock(pos);
+		}
+	}
+	else {
+		// ԑO̕Wۂċl߁Avf̈ʒu
+		const size_t first = *std::min_element(m_deadPositions.begin(), m_deadPositions.end());
+		m_handles.erase(std::remove_if(m_handles.begin() + first, m_handles.end(),
+			[](const ObjectHandle& h) { return !h.IsValid(); }), m_handles.end());
+		for (size_t i = first; i < m_handles.size(); ++i) {
+			m_positions[m_handles[i].index] = static_cast<uint32_t>(i);
+		}
+		m_resolvedDirty = true;
+	}
+	m_deadPositions.clear();
+}
+
+bool ObjectGroup::IsPending(ObjectHandle h)
+{
+	return ObjectManager::GetInstance().IsPending(h);
+}
+
+void ObjectGroup::StartCommitted()
+{
+	std::vector<ObjectHandle> awaiting;
 	{
 		std::lock_guard<std::mutex> lk(m_mutex);
-		snapshot = m_handles;
+		if (m_awaitingStart.empty()) return;
+		awaiting.swap(m_awaitingStart);
+	}
+
+	// Start ̓bNOŌĂԁiAdd Ɠj
+	auto& mgr = ObjectManager::GetInstance();
+	std::vector<ObjectHandle> stillPending;
+	for (auto h : awaiting) {
+		auto obj = mgr.PinRaw(h);
+		if (obj) obj->Start();
+		else if (mgr.IsPending(h)) stillPending.push_back(h);
 	}
 
+	if (stillPending.empty()) return;
+	std::lock_guard<std::mutex> lk(m_mutex);
+	m_awaitingStart.insert(m_awaitingStart.end(), stillPending.begin(), stillPending.end());
+}
+
+void ObjectGroup::ResetEntries_NoLock()
+{
+	m_awaitingStart.clear();
+	for (auto h : m_handles) {
+		if (h.IsValid()) m_positions[h.index] = NoPosition;
+	}
+	m_handles.clear();
+	m_deadPositions.clear();
+	m_resolvedDirty = true;
+}
+
+void ObjectGroup::Resolve()
+{
+	auto& mgr = ObjectManager::GetInstance();
+	const uint64_t frame = mgr.CurrentFrame();
+	const uint64_t stamp = mgr.ResolveStamp(); // Oɓǂށỉ͎̔ŏEj
+	if (!m_resolvedDirty && frame == m_resolvedFrame && stamp == m_resolvedStamp && m_resolved.size() == m_handles.size()) return;
+
+	m_resolved.resize(m_handles.size());
+	mgr.ResolveN(m_handles.data(), m_handles.size(), m_resolved.data());
+	m_resolvedFrame = frame;
+	m_resolvedStamp = stamp;
+	m_resolvedDirty = false;
+}
+
+GameObject* ObjectGroup::ResolvedAt(size_t i) const
+{
+	GameObject* obj = m_resolved[i];
+	// ̓rĩIuWFNg Update Ȃǁjŉꍇmߒ
+	if (obj && ObjectManager::GetInstance().ResolveStamp() != m_resolvedStamp && !ObjectManager::GetInstance().IsValid(m_handles[i])) {
+		return nullptr;
+	}
+	return obj;
+}
+
+// XibvVbg: nh ToUint64  64bit \ŏiW͏Aۗ̒ǉ͊܂߂j
+void ObjectGroup::Serialize(SnapshotWriter& out) const
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	out.Write(static_cast<uint32_t>(m_handles.size() - m_deadPositions.size() + m_pendingAdds.size()));
+	for (auto h : m_handles) {
+		if (h.IsValid()) out.Write(h.ToUint64());
+	}
+	for (auto h : m_pendingAdds) {
+		out.Write(h.ToUint64());
+	}
+}
+
+bool ObjectGroup::Deserialize(SnapshotReader& in, uint32_t requiredTypeId)
+{
+	uint32_t count = 0;
+	if (!in.Read(count)) return false;
+	if (count > in.Remaining() / sizeof(uint64_t)) return false; // ꂽf[^ŋȊmۂȂ悤
+
+	std::vector<ObjectHandle> handles;
+	handles.reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		uint64_t packed = 0;
+		if (!in.Read(packed)) return false;
+		const ObjectHandle h = ObjectHandle::FromUint64(packed);
+		if (requiredTypeId != 0 && h.typeId != requiredTypeId) return false; // ^tO[vɕʂ̌^͓Ȃ
+		handles.push_back(h);
+	}
+
+	std::lock_guard<std::mutex> lk(m_mutex);
+	ResetEntries_NoLock();
+	for (auto h : handles) {
+		if (h.IsValid()) AddEntry_NoLock(h);
+	}
+	m_pendingAdds.clear();
+	m_pendingRemoves.clear();
+	return true;
+}
+
+// qIuWFNg폜
+void ObjectGroup::RemoveAllChild()
+{
 	// eIuWFNgɑ΂Ďq폜Ă
-	for (auto handle : snapshot)
+	VisitResolved([](ObjectHandle handle, GameObject& obj)
 	{
-		auto obj = mgr.GetRaw(handle); // IuWFNg擾
-		if (obj)
-		{
-			// fobOo
-			OG_DEBUG_PRINTF("[ObjectGroup] RemoveAllChild handle idx=%u gen=%u ptr=%p use_count=%d\n",
-					handle.index, handle.generation, obj.get(), static_cast<int>(obj.use_count()));
-
-			// ȂXLbv
-			if (obj.get() == nullptr || obj.use_count() <= 0)
-			{
-				continue;
-			}
-			obj->RemoveAllChild(); // qIuWFNgS폜
-		}
-	}
+		// fobOo
+		OG_DEBUG_PRINTF("[ObjectGroup] RemoveAllChild handle idx=%u gen=%u ptr=%p\n",
+				handle.index, handle.generation, &obj);
+
+		obj.RemoveAllChild(); // qIuWFNgS폜
+	});
 }
\ No newline at end of file
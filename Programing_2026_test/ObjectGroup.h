@@ -1,19 +1,44 @@
 #pragma once
 #include "ObjectHandle.h"
+#include "SnapshotIO.h"
 #include <vector>
 #include <algorithm>
 #include <functional>
 #include <mutex>
 #include <memory>
+#include <utility>
+#include <thread>
 
 // Forward declarations to avoid circular includes
 class ObjectManager;
 class GameObject;
+template <typename T> class TypedObjectGroup;
 
+// iUpdateAll/DrawAll/ForEach Ȃǁj m_handles ̏ŉ񂷁it[̃Rs[mۂ͂Ȃj
+//  Add/Remove ͕ۗobt@ɐς݁AԊȎ̏Iɂ܂Ƃ߂Ĕf
+// ς݂̃nh͑ɕWinhjɂĂȀI1񂾂l߂
+// ̂̓t[Ƃ1 ObjectManager::ResolveN ł܂Ƃ߂ĉAUpdateAll  DrawAll Ŏg
+// 1ނ̌^ȂO[v TypedObjectGroup<T> gi͌^̍V[̃IuWFNgpj
+// Add/Remove/Clear ͂ǂ̃XbhĂł悢A͓1̃Xbh炾s
+// i̕WEʂ݂̏̓bNȂBXbhł̓q̑͂悢BʃXbh̓̓fobOrhŎ~߂j
+// nh̃Xbgԍт̈ʒu\ARemove  O(1)i͖ƓւĊÔŏ͕ۂȂj
 class ObjectGroup
 {
+	template <typename T> friend class TypedObjectGroup;
+
 public:
+	// 폜Ƃ̕т̈
+	enum class Order
+	{
+		Unordered, // ̗vf󂢂ʒuֈڂiO(1)BeȂǏǂł悢́j
+		Stable,    // WɂĂȀIɂ܂Ƃ߂ċl߂iۂB`揇厖ȃV[̃IuWFNgpj
+	};
+
+	explicit ObjectGroup(Order order = Order::Unordered) : m_order(order) {}
+
 	// nhǉinh͖j
+	// nh͓dɓo^ȂBXbǧÂiς݁jcĂΒu
+	// ҂̃nhiCreateAsyncj́Ai[ꂽ̍ŏ UpdateAll  Start Ă
 	void Add(ObjectHandle h);
 	// : nh
 
@@ -39,14 +64,147 @@ public:
 
 	// Cӂ̑eIuWFNgɑ΂čswp[
 	void ForEach(const std::function<void(std::shared_ptr<GameObject>)>& func);
-	// : eIuWFNgɑ΂čs֐
+	// : eIuWFNgɑ΂čs֐ishared_ptr ƂpBvfƂɎQƃJEgςj
+
+	// Cӂ̑eIuWFNgɑ΂čsif(GameObject&)BQƃJEg͕ςA_̓CCWJj
+	// GameObject& ŌĂׂȂ֐ishared_ptr 󂯂̂Ȃǁj͏ std::function łɂȂ
+	template <typename F, typename = decltype(std::declval<F&>()(std::declval<GameObject&>()))>
+	void ForEach(F&& f);
+
+	// pred(GameObject&)  true ɂȂIuWFNg1ł邩i_ő߂j
+	template <typename Pred>
+	bool AnyOf(Pred&& pred) { return FindIf(std::forward<Pred>(pred)).IsValid(); }
+
+	// pred(GameObject&)  true ɂȂŏ̃IuWFNg̃nhiΖnhB_ő߂j
+	template <typename Pred>
+	ObjectHandle FindIf(Pred&& pred);
 
 	// qIuWFNg폜
 	void RemoveAllChild();
 	// eIuWFNgEndȂǂŌĂ
 	// RemoveAllChild EndAll Clear ̏ŌĂԂ
 
+	// XibvVbg: nḧꗗo^ǂݖ߂iǂݖ߂ł Start Ă΂Ȃj
+	// requiredTypeId  0 ȊOȂA^^ÖႤnhĂƂɎs
+	void Serialize(SnapshotWriter& out) const;
+	bool Deserialize(SnapshotReader& in, uint32_t requiredTypeId = 0);
+	// LIuWFNg Serialize/Deserialize Ă
+
 private:
-	std::vector<ObjectHandle> m_handles; // IuWFNgnh̃Xg
-	std::mutex m_mutex;
-};
\ No newline at end of file
+	// ̊JnEIiqBIɈԊOȂۗ𔽉fĕWl߂j
+	void BeginIteration();
+	void EndIteration();
+
+	// ͈̔͂\iXR[v𔲂 EndIterationj
+	struct IterationScope
+	{
+		explicit IterationScope(ObjectGroup& group) : m_group(group) { m_group.BeginIteration(); }
+		~IterationScope() { m_group.EndIteration(); }
+		ObjectGroup& m_group;
+	};
+
+	// Ɍς݃nhWɂiĂXbhĂԁj
+	void MarkDead(size_t index);
+
+	// ҂iCreateAsync ̒ォ玟 AdvanceFrame ܂Łj̃nhBŉłȂƂĂ
+	static bool IsPending(ObjectHandle h);
+
+	// ҂̂܂ܒǉꂽnĥAi[ς񂾂̂ Start ĂԁiUpdateAll ̐擪ŌĂԁj
+	// ɉꂽ͎̂̂āA܂҂͎̂̂ɉ
+	void StartCommitted();
+
+	// ۗ̒ǉE폜𔽉fAWl߂ibNEĂȂƂɌĂԁj
+	void ApplyPending_NoLock();
+
+	// ȉ̓bNA܂͑ĂXbhĂ
+	// Xbgԍ index ̃nhт̈ʒui NoPositionj
+	uint32_t PositionOf_NoLock(uint32_t index) const;
+	// тɉido^EÂ̒uňBĂȂƂɌĂԁj
+	void AddEntry_NoLock(ObjectHandle h);
+	// pos ̗vfWɂiт͕̒ςȂj
+	void Tombstone_NoLock(size_t pos);
+	// pos ̗vf𖖔̗vfƓւĊOiĂȂƂɌĂԁj
+	void SwapPop_NoLock(size_t pos);
+	// Wl߂iUnordered ͖疄߁AStable ͏ۂċl߂BĂȂƂɌĂԁj
+	void CompactTombstones_NoLock();
+	// тɂiʒu̕\߂j
+	void ResetEntries_NoLock();
+
+	// m_handles ̎̂ m_resolved ɉĩt[ɉς݂ŁǍɕт̕ύXΉȂj
+	// im_handles ̗vfςȂԁjɁAĂXbhĂԁibN͎Ȃj
+	void Resolve();
+
+	// i Ԗڂ̉ʂԂiɂǂŉꍇ́ÃnhbNŊmߒj
+	GameObject* ResolvedAt(size_t i) const;
+
+	// ĂIuWFNg f(handle, obj) ֓nAf  true Ԃ炻ł߂ẴnhԂiς݂͕Wɂj
+	// UpdateAll/DrawAll/ForEach/FindIf  TypedObjectGroup ̋ʕBf ̓ev[gŎ󂯂̂ŃCCWJ
+	template <typename F>
+	ObjectHandle VisitResolvedUntil(F&& f);
+
+	// VisitResolvedUntil ̓rł߂ȂŁif(handle, obj) ̖߂l͎gȂj
+	template <typename F>
+	void VisitResolved(F&& f)
+	{
+		VisitResolvedUntil([&f](ObjectHandle handle, GameObject& obj) { f(handle, obj); return false; });
+	}
+
+private:
+	static const uint32_t NoPosition = 0xFFFFFFFFu; // m_positions ́uтɖv
+
+	std::vector<ObjectHandle> m_handles; // IuWFNgnh̃XgiW = nh܂ނƂj
+	std::vector<uint32_t> m_positions; // nh̃Xbgԍ -> m_handles ̈ʒuiWɂȂ̂ NoPositionj
+	std::vector<uint32_t> m_deadPositions; // m_handles ̕Ẅʒuî܂ܕW̐j
+	std::vector<ObjectHandle> m_pendingAdds; // ɒǉꂽnh
+	std::vector<ObjectHandle> m_pendingRemoves; // ɍ폜ꂽnh
+	std::vector<ObjectHandle> m_awaitingStart; // ҂̂܂ܒǉA܂ Start ĂłȂnh
+	Order m_order; // 폜Ƃ̕т̈
+	int m_iterating = 0; // ̓q̐[im_mutex ŕیB0 ȊO̊Ԃ m_handles ̗vfςȂj
+	std::thread::id m_iteratingThread; // ĂXbhim_mutex ŕیBm_iterating  0 ̊Ԃ͈ӖȂj
+	bool m_clearOnEnd = false; //  Clear ꂽiIɋɂj
+
+	// ̂̉ʁim_handles ƓсBmۂeʂ͎g񂷁j
+	std::vector<GameObject*> m_resolved;
+	uint64_t m_resolvedFrame = 0; // t[
+	uint64_t m_resolvedStamp = 0; // Ƃ ObjectManager::ResolveStamp
+	bool m_resolvedDirty = true; //  m_handles ςim_mutex ŕیA͕ςȂj
+	mutable std::mutex m_mutex;
+};
+
+template <typename F>
+ObjectHandle ObjectGroup::VisitResolvedUntil(F&& f)
+{
+	IterationScope scope(*this);
+
+	// ̂͂܂Ƃ߂ĉ|C^ŎQƂi1vfƂ̃bNQƃJEg̍XVj
+	Resolve();
+
+	for (size_t i = 0; i < m_handles.size(); ++i)
+	{
+		const ObjectHandle handle = m_handles[i];
+		if (!handle.IsValid()) continue; // W
+
+		GameObject* obj = ResolvedAt(i);
+		if (!obj)
+		{
+			// ς -> Wɂđ̏Iɋl߂i҂͂܂̂Ȃ̂Ŏcj
+			if (!IsPending(handle)) MarkDead(i);
+			continue;
+		}
+
+		if (f(handle, *obj)) return handle;
+	}
+	return ObjectHandle();
+}
+
+template <typename F, typename>
+void ObjectGroup::ForEach(F&& f)
+{
+	VisitResolved([&f](ObjectHandle, GameObject& obj) { f(obj); });
+}
+
+template <typename Pred>
+ObjectHandle ObjectGroup::FindIf(Pred&& pred)
+{
+	return VisitResolvedUntil([&pred](ObjectHandle, GameObject& obj) { return static_cast<bool>(pred(obj)); });
+}
\ No newline at end of file
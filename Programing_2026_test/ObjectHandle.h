@@ -1,35 +1,42 @@
 #pragma once
+#include "ObjectTypeId.h"
 #include <cstdint>
 #include <limits>
 #include <string>
 #include <sstream>
 
+// 64bit \: [63..56] ^^O / [55..32] ԍ / [31..0] CfbNX
 struct ObjectHandle
 {
-	uint32_t index;			// XbgCfbNX
-	uint32_t generation;	// ԍ
+	uint32_t index;				// XbgCfbNX
+	uint32_t generation : 24;	// ԍi24bit ŏzj
+	uint32_t typeId : 8;		// ^^OiObjectTypeIdB0 Ȃ^Ȃj
 
-	ObjectHandle() noexcept : index((std::numeric_limits<uint32_t>::max)()), generation(0) {} // nh
-	ObjectHandle(uint32_t idx, uint32_t gen) noexcept : index(idx), generation(gen) {}		// Lnh
+	static const uint32_t GenerationMask = 0x00FFFFFFu; // ԍ̗Lrbg
+
+	ObjectHandle() noexcept : index((std::numeric_limits<uint32_t>::max)()), generation(0), typeId(0) {} // nh
+	ObjectHandle(uint32_t idx, uint32_t gen, uint32_t type = 0) noexcept
+		: index(idx), generation(gen & GenerationMask), typeId(type & 0xFFu) {}						// Lnh
 
 	bool IsValid() const noexcept { return index != (std::numeric_limits<uint32_t>::max)(); } // L
 
 	// Uint64 ϊinh 64bit ɃpbNj
 	uint64_t ToUint64() const noexcept
 	{
-		return (static_cast<uint64_t>(generation) << 32) | index;
+		return (static_cast<uint64_t>(typeId) << 56) | (static_cast<uint64_t>(generation) << 32) | index;
 	}
 
 	// Uint64 ϊi64bit nhɃApbNj
 	static ObjectHandle FromUint64(uint64_t v) noexcept
 	{
 		uint32_t idx = static_cast<uint32_t>(v & 0xFFFFFFFFu);
-		uint32_t gen = static_cast<uint32_t>(v >> 32);
-		return ObjectHandle(idx, gen);
+		uint32_t gen = static_cast<uint32_t>((v >> 32) & GenerationMask);
+		uint32_t type = static_cast<uint32_t>(v >> 56);
+		return ObjectHandle(idx, gen, type);
 	}
 
 	// rZq
-	bool operator==(ObjectHandle const& o) const noexcept { return index == o.index && generation == o.generation; } // r
+	bool operator==(ObjectHandle const& o) const noexcept { return index == o.index && generation == o.generation && typeId == o.typeId; } // r
 	bool operator!=(ObjectHandle const& o) const noexcept { return !(*this == o); }									 // 񓙉r
 
 	// fobOpϊ
@@ -37,8 +44,21 @@ struct ObjectHandle
 	std::string ToString() const
 	{
 		std::ostringstream ss;
-		ss << "Handle(idx=" << index << ", gen=" << generation << ")";
+		ss << "Handle(idx=" << index << ", gen=" << generation << ", type=" << typeId << ")";
 		return ss.str();
 	}
 #endif
+};
+
+// ^tnh: ^^O T ƈv邱Ƃۏ؂ ObjectHandle
+// ObjectHandle ւ͈Öقɕϊł̂ŁA]̌^Ȃ API ɂ̂܂ܓn
+template <typename T>
+struct TypedHandle : public ObjectHandle
+{
+	TypedHandle() noexcept : ObjectHandle() {} // nh
+	TypedHandle(uint32_t idx, uint32_t gen) noexcept : ObjectHandle(idx, gen, ObjectTypeId::Of<T>()) {} // Lnh
+
+	// ^Ȃnhϊi^^OvȂΖnhɂȂj
+	explicit TypedHandle(ObjectHandle h) noexcept
+		: ObjectHandle(h.typeId == ObjectTypeId::Of<T>() ? h : ObjectHandle()) {}
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "ObjectManager.h"
 #include "DxLib.h"
+#include <fstream>
+#include <algorithm>
 
 // VOg擾
 ObjectManager& ObjectManager::GetInstance()
@@ -11,9 +13,205 @@ ObjectManager& ObjectManager::GetInstance()
 // Sj̎
 void ObjectManager::ClearAll()
 {
+	// \񂳂ꂽ܂܂͔̉ĵŎ̂Ă
+	{
+		std::lock_guard<std::mutex> lk(m_pendingMutex);
+		m_pendingReleases.clear();
+	}
+
+	// jOɍ̃ZbV̍ő哯gpvt@C֏߂
+	if (!m_profilePath.empty()) {
+		SaveProfile(m_profilePath);
+	}
 	m_pool.ClearAll();
 }
 
+// \it[̓IuWFNĝ܂܎g悤ɂj
+void ObjectManager::ReleaseDeferred(ObjectHandle handle)
+{
+	if (!handle.IsValid()) return;
+	std::lock_guard<std::mutex> lk(m_pendingMutex);
+	m_pendingReleases.push_back(handle);
+}
+
+// \񂳂ꂽ܂Ƃ߂Ďs
+size_t ObjectManager::FlushReleases()
+{
+	{
+		std::lock_guard<std::mutex> lk(m_pendingMutex);
+		if (m_pendingReleases.empty()) return 0;
+		m_flushBuffer.swap(m_pendingReleases); // \L[͋̃obt@Ɠւ
+	}
+
+	// nh\񂳂ĂĂ1񂾂
+	std::sort(m_flushBuffer.begin(), m_flushBuffer.end(),
+		[](const ObjectHandle& a, const ObjectHandle& b) { return a.ToUint64() < b.ToUint64(); });
+	m_flushBuffer.erase(std::unique(m_flushBuffer.begin(), m_flushBuffer.end()), m_flushBuffer.end());
+
+	size_t released = m_pool.ReleaseN(m_flushBuffer.data(), m_flushBuffer.size());
+	m_flushBuffer.clear();
+	return released;
+}
+
+// o^ς݂̌^vt@Cɏ]ĎO
+size_t ObjectManager::ReserveProfiled()
+{
+	size_t created = 0;
+	for (const TypeEntry& entry : m_types)
+	{
+		if (!entry.reserve) continue; // o^̌^ID
+		created += entry.reserve(ProfiledCount(entry.name, entry.defaultReserve));
+	}
+	return created;
+}
+
+size_t ObjectManager::ProfiledCount(const std::string& typeName, size_t fallback) const
+{
+	auto it = m_profile.find(typeName);
+	return it != m_profile.end() ? it->second : fallback;
+}
+
+// vt@C̓ǂݍ
+// `: [magic u32][version u32][entryCount u32] + entryCount * ([nameLen u16][name bytes][peak u32])
+bool ObjectManager::LoadProfile(const std::string& path)
+{
+	m_profilePath = path;
+	m_profile.clear();
+
+	std::ifstream in(path, std::ios::binary);
+	if (!in) return false; // NȂǂŃt@C
+
+	uint32_t magic = 0, version = 0, entryCount = 0;
+	in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+	in.read(reinterpret_cast<char*>(&version), sizeof(version));
+	in.read(reinterpret_cast<char*>(&entryCount), sizeof(entryCount));
+	if (!in || magic != ProfileMagic || version != ProfileVersion) {
+		OutputDebugStringA("[ObjectManager] LoadProfile: invalid header\n");
+		return false;
+	}
+
+	for (uint32_t i = 0; i < entryCount; ++i)
+	{
+		uint16_t nameLen = 0;
+		uint32_t peak = 0;
+		in.read(reinterpret_cast<char*>(&nameLen), sizeof(nameLen));
+		std::string name(nameLen, '\0');
+		if (nameLen > 0) in.read(&name[0], nameLen);
+		in.read(reinterpret_cast<char*>(&peak), sizeof(peak));
+		if (!in) {
+			OutputDebugStringA("[ObjectManager] LoadProfile: truncated file\n");
+			m_profile.clear();
+			return false;
+		}
+		m_profile[name] = peak;
+	}
+
+	char buf[128];
+	sprintf_s(buf, "[ObjectManager] LoadProfile entries=%u\n", entryCount);
+	OutputDebugStringA(buf);
+	return true;
+}
+
+// vt@C̕ۑ
+// gꂽ^͍̍őlAgȂ^͑O̒lc
+bool ObjectManager::SaveProfile(const std::string& path) const
+{
+	std::unordered_map<std::string, size_t> merged = m_profile;
+	const uint32_t typeCount = ObjectTypeId::Count();
+	for (uint32_t typeId = 1; typeId <= typeCount; ++typeId)
+	{
+		size_t peak = m_pool.CountsOf(typeId).peak;
+		if (peak == 0) continue;
+		merged[ObjectTypeId::NameOf(typeId)] = peak;
+	}
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out) return false;
+
+	const uint32_t magic = ProfileMagic, version = ProfileVersion;
+	const uint32_t entryCount = static_cast<uint32_t>(merged.size());
+	out.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+	out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	out.write(reinterpret_cast<const char*>(&entryCount), sizeof(entryCount));
+	for (const auto& kv : merged)
+	{
+		const uint16_t nameLen = static_cast<uint16_t>(std::min<size_t>(kv.first.size(), 0xFFFF));
+		const uint32_t peak = static_cast<uint32_t>(std::min<size_t>(kv.second, 0xFFFFFFFFu));
+		out.write(reinterpret_cast<const char*>(&nameLen), sizeof(nameLen));
+		out.write(kv.first.data(), nameLen);
+		out.write(reinterpret_cast<const char*>(&peak), sizeof(peak));
+	}
+	return static_cast<bool>(out);
+}
+
+// eg CSV o
+// : type, active, idle, peak, 擾oH̓, prebuilt, releases, evictions, 擾Ԃ̃qXgOilat_lt_<>nsj
+bool ObjectManager::DumpStatsCsv(const std::string& path) const
+{
+	std::ofstream out(path, std::ios::trunc);
+	if (!out) return false;
+
+	out << "type,active,idle,peak,freeHits,emptyReuse,mismatchOverwrites,newSlots,prebuilt,releases,evictions";
+	for (size_t b = 0; b < ObjectPool::TypeStats::LatencyBuckets; ++b)
+	{
+		if (b + 1 < ObjectPool::TypeStats::LatencyBuckets) out << ",lat_lt_" << (1ull << (b + 1)) << "ns";
+		else out << ",lat_rest";
+	}
+	out << "\n";
+
+	const uint32_t typeCount = ObjectTypeId::Count();
+	for (uint32_t typeId = 1; typeId <= typeCount; ++typeId)
+	{
+		const ObjectPool::TypeStats s = m_pool.StatsOf(typeId);
+		if (s.peak == 0 && s.prebuilt == 0) continue; // gĂȂ^
+		out << '"' << ObjectTypeId::NameOf(typeId) << '"' << ',' << s.active << ',' << s.idle << ',' << s.peak
+			<< ',' << s.freeHits << ',' << s.emptyReuse << ',' << s.mismatchOverwrites << ',' << s.newSlots
+			<< ',' << s.prebuilt << ',' << s.releases << ',' << s.evictions;
+		for (size_t b = 0; b < ObjectPool::TypeStats::LatencyBuckets; ++b) out << ',' << s.latency[b];
+		out << "\n";
+	}
+	return static_cast<bool>(out);
+}
+
+// eg JSON o
+// { "latencyBucketNs": [...], "types": [ { "name": ..., ..., "latency": [...] } ] }
+bool ObjectManager::DumpStatsJson(const std::string& path) const
+{
+	std::ofstream out(path, std::ios::trunc);
+	if (!out) return false;
+
+	out << "{\n  \"latencyBucketNs\": [";
+	for (size_t b = 0; b < ObjectPool::TypeStats::LatencyBuckets; ++b) out << (b ? ", " : "") << (1ull << b);
+	out << "],\n  \"types\": [";
+
+	bool first = true;
+	const uint32_t typeCount = ObjectTypeId::Count();
+	for (uint32_t typeId = 1; typeId <= typeCount; ++typeId)
+	{
+		const ObjectPool::TypeStats s = m_pool.StatsOf(typeId);
+		if (s.peak == 0 && s.prebuilt == 0) continue;
+
+		// ^itypeid  namejɋL͓Ȃ͂AÔ "  \ ̓GXP[v
+		std::string name;
+		for (const char* p = ObjectTypeId::NameOf(typeId); *p; ++p) {
+			if (*p == '"' || *p == '\\') name += '\\';
+			name += *p;
+		}
+
+		out << (first ? "\n" : ",\n") << "    { \"name\": \"" << name << "\""
+			<< ", \"active\": " << s.active << ", \"idle\": " << s.idle << ", \"peak\": " << s.peak
+			<< ", \"freeHits\": " << s.freeHits << ", \"emptyReuse\": " << s.emptyReuse
+			<< ", \"mismatchOverwrites\": " << s.mismatchOverwrites << ", \"newSlots\": " << s.newSlots
+			<< ", \"prebuilt\": " << s.prebuilt << ", \"releases\": " << s.releases << ", \"evictions\": " << s.evictions
+			<< ", \"latency\": [";
+		for (size_t b = 0; b < ObjectPool::TypeStats::LatencyBuckets; ++b) out << (b ? ", " : "") << s.latency[b];
+		out << "] }";
+		first = false;
+	}
+	out << "\n  ]\n}\n";
+	return static_cast<bool>(out);
+}
+
 // fobO\: ݂̃ANeBuIuWFNgʂɕ`悷
 void ObjectManager::DrawObjectCount(int x, int y) const
 {
@@ -26,6 +224,59 @@ void ObjectManager::DrawObjectCount(int x, int y) const
 		static_cast<int>(active), static_cast<int>(total), static_cast<int>(deleted));
 }
 
+size_t ObjectManager::Snapshot(std::vector<uint8_t>& buffer) const
+{
+	buffer.clear();
+
+	// 擪Ɍ݂̃V[̃IuWFNgO[vTCYtŏiV[΋̃O[vj
+	SnapshotWriter out(buffer);
+	const size_t sizePos = out.Size();
+	out.Write(static_cast<uint32_t>(0));
+	if (auto scene = SceneBase::GetCurrentSceneWeak().lock()) scene->SerializeObjects(out);
+	else out.Write(static_cast<uint32_t>(0));
+	out.WriteAt(sizePos, static_cast<uint32_t>(out.Size() - sizePos - sizeof(uint32_t)));
+
+	// ăv[̃Xbg\
+	return m_pool.Snapshot(buffer);
+}
+
+bool ObjectManager::Restore(const std::vector<uint8_t>& buffer)
+{
+	// XibvVbgɗ\񂳂ꂽ́ÃIuWFNgɂ͓Ă͂܂Ȃ̂Ŏ̂Ă
+	{
+		std::lock_guard<std::mutex> lk(m_pendingMutex);
+		m_pendingReleases.clear();
+	}
+
+	// V[̃IuWFNgO[v̕iǂݖ߂̂̓v[̌̕j
+	SnapshotReader in(buffer.data(), buffer.size());
+	uint32_t groupSize = 0;
+	if (!in.Read(groupSize)) return false;
+	const uint8_t* groupData = in.ReadBytes(groupSize);
+	if (!groupData) return false;
+	const uint8_t* poolData = groupData + groupSize;
+	const size_t poolSize = buffer.size() - static_cast<size_t>(poolData - buffer.data());
+
+	const std::weak_ptr<SceneBase> sceneWeak = SceneBase::GetCurrentSceneWeak();
+	bool slotsRewritten = false;
+	bool ok = m_pool.Restore(poolData, poolSize, [this](uint32_t typeId) -> std::shared_ptr<GameObject> {
+		if (typeId >= m_types.size() || !m_types[typeId].create) return nullptr;
+		return m_types[typeId].create();
+	}, sceneWeak, &slotsRewritten);
+	if (!slotsRewritten) return false; // ύXĂȂ
+
+	// V[̃O[v̓XibvVbg̃nhi̖߂XbgwjĂ̂ŁAXibvVbg̕тɒu
+	// iXibvVbgɃO[vOIuWFNgA΍ĂуO[vōXVE`Ej
+	if (auto scene = sceneWeak.lock()) {
+		SnapshotReader group(groupData, groupSize);
+		if (!scene->DeserializeObjects(group)) {
+			OutputDebugStringA("[ObjectManager] Restore: scene object group could not be restored\n");
+			ok = false;
+		}
+	}
+	return ok;
+}
+
 void ObjectManager::UpdateAllObjectsScene(const std::weak_ptr<SceneBase>& scene)
 {
 	m_pool.UpdateAllObjectsScene(scene);
@@ -35,5 +286,10 @@ void ObjectManager::UpdateAllObjectsScene(const std::weak_ptr<SceneBase>& scene)
 void ObjectManager::RegisterCurrentScene(const std::shared_ptr<SceneBase>& scene)
 {
 	SceneBase::SetCurrentScene(scene);
+
+	// ÕV[ŐIuWFNg܂Ƃ߂ĕЕtĂAVV[̃A[iJ
+	m_pool.EndSceneArena(m_sceneArena);
+	m_sceneArena = m_pool.BeginSceneArena();
+
 	m_pool.UpdateAllObjectsScene(SceneBase::GetCurrentSceneWeak());
 }
\ No newline at end of file
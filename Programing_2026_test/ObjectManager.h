@@ -6,6 +6,11 @@
 #include "SceneBase.h"
 #include <memory>
 #include <type_traits>
+#include <functional>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
 #include <windows.h>
 
 
@@ -17,12 +22,81 @@ public:
 
 	// Create (ev[gAwb_)
 	template <typename T, typename... Args>
-	ObjectHandle Create(Args&&... args)
+	TypedHandle<T> Create(Args&&... args)
 	{
 		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
 		return m_pool.Acquire<T>(std::forward<Args>(args)...); // IuWFNgv[nh擾
 	}
 
+	// CreateN :  count ܂Ƃ߂ĐAout Ƀnhށi߂l͐łj
+	template <typename T, typename... Args>
+	size_t CreateN(size_t count, ObjectHandle* out, const Args&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
+		return m_pool.AcquireN<T>(count, out, args...); // bN܂Ƃ߂Ď擾
+	}
+
+	// CreateAsync : [J[XbhōsA҂̃nhԂi AdvanceFrame Lj
+	// T ̃RXgN^̓[J[Xbhœ̂ DxLib ̊֐Ă΂ȂƁiInitObject / Reset ōsj
+	template <typename T, typename... Args>
+	TypedHandle<T> CreateAsync(const Args&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
+		return m_pool.AcquireAsync<T>(args...);
+	}
+
+	// ҂̃nh
+	bool IsPending(ObjectHandle handle) const { return m_pool.IsPending(handle); }
+
+	// Reserve : ^ T ̑ҋ@CX^X count ܂ŎOi[hɌĂсAQ[̐炷j
+	template <typename T, typename... Args>
+	size_t Reserve(size_t count, const Args&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
+		return m_pool.Reserve<T>(count, args...); // O CleanupIdle ̑ΏۊO
+	}
+
+	// RegisterType : ^ T o^AOɎg̐Ɗ̎Oݒ肷
+	// ivt@CɋL^^͂̐A^ defaultReserve  ReserveProfiled ŎOj
+	template <typename T, typename... Args>
+	void RegisterType(size_t defaultReserve, const Args&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+		if (typeId >= m_types.size()) m_types.resize(typeId + 1);
+
+		TypeEntry& entry = m_types[typeId];
+		entry.name = typeid(T).name();
+		entry.defaultReserve = defaultReserve;
+		entry.reserve = [this, args...](size_t count) { return m_pool.Reserve<T>(count, args...); };
+		entry.create = [args...]() -> std::shared_ptr<GameObject> { return Factory::GetInstance().CreateObject<T>(args...); };
+	}
+
+	// SetRefill : o^ς݂̌^ T ̑ҋ@ lowWater  target ܂Ń[J[Xbhŕ[
+	// i RegisterType œo^́BlowWater  0 ɂƕ[߂j
+	// T ̃RXgN^̓[J[Xbhœ̂ DxLib ̊֐Ă΂ȂƁiInitObject / Reset ōsj
+	template <typename T>
+	void SetRefill(size_t lowWater, size_t target)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+		ASSERT_MSG(typeId < m_types.size() && m_types[typeId].create, "SetRefill: type is not registered");
+		if (typeId >= m_types.size() || !m_types[typeId].create) return;
+		m_pool.SetRefill(typeId, lowWater, target, m_types[typeId].create);
+	}
+
+	// ReserveProfiled : o^ς݂̑SĂ̌^vt@CiO܂ł̍ő哯gpjɏ]ĎO
+	size_t ReserveProfiled();
+
+	// vt@C̓ǂݍ݁iNɌĂԁBŎw肵pX ClearAll ɏ߂j
+	bool LoadProfile(const std::string& path);
+
+	// vt@C̕ۑi^Ƃ̍ő哯gpoj
+	bool SaveProfile(const std::string& path) const;
+
+	// vt@C̎OiL^ fallbackj
+	size_t ProfiledCount(const std::string& typeName, size_t fallback) const;
+
 	// Get typed : nh shared_ptr<T> 擾
 	template <typename T>
 	std::shared_ptr<T> Get(ObjectHandle handle)
@@ -31,12 +105,52 @@ public:
 		return m_pool.Get<T>(handle); // nh shared_ptr<T> 擾
 	}
 
+	// Get typed : ^tnh shared_ptr<T> 擾i^͌^^O̐r̂݁j
+	template <typename T>
+	std::shared_ptr<T> Get(TypedHandle<T> handle)
+	{
+		return m_pool.Get<T>(handle);
+	}
+
 	// Get raw : ̂܂ shared_ptr<GameObject> 擾
 	std::shared_ptr<GameObject> GetRaw(ObjectHandle handle)
 	{
 		return m_pool.Get(handle);
 	}
 
+	// Pin : ݂̃t[̊ԂL T* 擾iQƃJEg𑀍삵ȂBt[܂ŕێȂƁj
+	template <typename T>
+	FramePin<T> Pin(ObjectHandle handle)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject"); // T  GameObject hł邱ƂmF
+		return m_pool.Pin<T>(handle);
+	}
+
+	// Pin typed : ^tnh
+	template <typename T>
+	FramePin<T> Pin(TypedHandle<T> handle)
+	{
+		return m_pool.Pin<T>(handle);
+	}
+
+	// Pin raw : FramePin<GameObject> 擾iO[v̈ꊇ Update/Draw pj
+	FramePin<GameObject> PinRaw(ObjectHandle handle)
+	{
+		return m_pool.Pin(handle);
+	}
+
+	// ResolveN : ̃nh1̃bNŐ|C^ɉiȂ̂ nullptrBO[v̈ꊇ Update/Draw pj
+	size_t ResolveN(const ObjectHandle* handles, size_t count, GameObject** out) const
+	{
+		return m_pool.ResolveN(handles, count, out);
+	}
+
+	// ResolveN ̌ʂg񂵂Ă悢̔pi邽тɐiށj
+	uint64_t ResolveStamp() const { return m_pool.ResolveStamp(); }
+
+	// ݂̃t[ԍiResolveN ̌ʂ͂̃t[̊ԂLj
+	uint64_t CurrentFrame() const { return m_pool.CurrentFrame(); }
+
 	// Release : nhɑΉIuWFNgv[ɖ߂
 	bool Release(ObjectHandle handle)
 	{
@@ -47,11 +161,60 @@ public:
 		return m_pool.Release(handle);
 	}
 
+	// ReleaseDeferred : \񂷂iFlushReleases ܂Ŏ̂͗LȂ܂܁BUpdate/Փ˃R[obN̎ȉpj
+	void ReleaseDeferred(ObjectHandle handle);
+
+	// FlushReleases : \񂳂ꂽdĂ܂Ƃ߂ăv[֖߂iMain ̃[v1t[1Ăԁj
+	size_t FlushReleases();
+
+	// Snapshot : gp̑SIuWFNgƁÃ݂V[̃IuWFNgO[v buffer ɃoCiŏoibuffer ̒g͒uB߂l̓IuWFNgj
+	size_t Snapshot(std::vector<uint8_t>& buffer) const;
+
+	// Restore : Snapshot ̓eɖ߂iXibvVbg̃nĥ܂ܗLɂȂB\͔jj
+	// ̂蒼^ RegisterType œo^ĂƁBvZXŎXibvVbĝݎg
+	// IuWFNg݂͌̃V[iSceneBase::GetCurrentSceneWeakjɏAV[̃IuWFNgO[vXibvVbg̕тɍ蒼
+	// XibvVbgɎnh͐オ߂̂ŁAV[̃O[vƕIuWFNg̊OŎȂ
+	bool Restore(const std::vector<uint8_t>& buffer);
+
+	// ReleaseN : ̃nh܂Ƃ߂ăv[ɖ߂i߂l͉łj
+	size_t ReleaseN(const ObjectHandle* handles, size_t count)
+	{
+		return m_pool.ReleaseN(handles, count);
+	}
+
 	// Utility
 	bool IsValid(ObjectHandle handle) { return m_pool.IsHandleValid(handle); }	// nh̗L`FbN
 	size_t PoolSize() const { return m_pool.PoolSize(); }						// v[TCY擾
 	size_t FreeCount() const { return m_pool.FreeCount(); }					// 󂫃Xbg擾
 
+	// ForEachLive : ^ T ̎gpIuWFNgׂĂ fn(T&) ĂԁiCXbhpAnhȂj
+	template <typename T, typename F>
+	void ForEachLive(F&& fn) { m_pool.ForEachLive<T>(std::forward<F>(fn)); }
+
+	// ^ T ̎gpIuWFNg
+	template <typename T>
+	size_t LiveCount() const { return m_pool.LiveCount<T>(); }
+
+	// ^ʃJEg̎擾igp^󂫃Xgőҋ@j
+	template <typename T>
+	ObjectPool::TypeCounts CountsOf() const { return m_pool.CountsOf<T>(); }
+
+	// ^ʂ̃eg̎擾i擾oH̓EjE擾Ԃ̃qXgOj
+	template <typename T>
+	ObjectPool::TypeStats StatsOf() const { return m_pool.StatsOf<T>(); }
+
+	// eg 0 ɖ߂ivԂ̑OɌĂԁj
+	void ResetStats() { m_pool.ResetStats(); }
+
+	// 擾Ԃ̃qXgOv邩i falseB񐔂̃eg͏ɐj
+	void SetTelemetryEnabled(bool enabled) { m_pool.SetTelemetryEnabled(enabled); }
+
+	// gꂽSĂ̌^̃eg CSV ŏoi1s1^Bv[̎ǑςɎgj
+	bool DumpStatsCsv(const std::string& path) const;
+
+	// e JSON ŏo
+	bool DumpStatsJson(const std::string& path) const;
+
 	// Sjî cpp Ŏj
 	void ClearAll();
 
@@ -64,6 +227,34 @@ public:
 		return m_pool.CleanupIdle(maxIdleSeconds);
 	}
 
+	// ^Ƃ̗\Zigp + ҋ@̃CX^XEoCgjƏ̓ݒ肷
+	template <typename T>
+	void SetTypeBudget(const ObjectPool::Budget& budget) { m_pool.SetTypeBudget<T>(budget); }
+
+	// Ŝ̗\Zݒ肷iłOɉꂽҋ@CX^Xjj
+	void SetGlobalBudget(const ObjectPool::Budget& budget) { m_pool.SetGlobalBudget(budget); }
+
+	// ̋󂫃Xbgl߂ibpBXbg̃`Ñ͎cj
+	size_t Compact() { return m_pool.Compact(); }
+
+	// ̋lߒLɂiV[ؑ֎ƁAXbg quietFrames t[ĂȂƂj
+	void SetAutoCompact(bool enabled, uint64_t quietFrames) { m_pool.SetAutoCompact(enabled, quietFrames); }
+
+	// t[i߂iMain ̃[v1t[1ATime::Update ̌ɌĂԁBÕt[ Pin ͂ŖɂȂj
+	void AdvanceFrame(double deltaSeconds) { m_pool.AdvanceFrame(deltaSeconds); }
+
+	// N[Abvit[w̃bpj
+	size_t CleanupIdleStepFrames(uint64_t maxIdleFrames, size_t maxSlotsPerCall, double maxMicros)
+	{
+		return m_pool.CleanupIdleStepFrames(maxIdleFrames, maxSlotsPerCall, maxMicros);
+	}
+
+	// N[Abvibpj: 1t[̏ƎԂ𐧌ď
+	size_t CleanupIdleStep(double maxIdleSeconds, size_t maxSlotsPerCall, double maxMicros)
+	{
+		return m_pool.CleanupIdleStep(maxIdleSeconds, maxSlotsPerCall, maxMicros);
+	}
+
 	// fobOpԏo
 	void DumpState() const { m_pool.DumpState(); }
 
@@ -71,6 +262,7 @@ public:
 	void UpdateAllObjectsScene(const std::weak_ptr<SceneBase>& scene);
 
 	// ݂̃V[o^ăv[IuWFNg scene XV郆[eBeB
+	// ÕV[̃A[iāicĂIuWFNg܂Ƃ߂ĔjjAVV[̃A[iJ
 	void RegisterCurrentScene(const std::shared_ptr<SceneBase>& scene);
 
 private:
@@ -80,6 +272,28 @@ private:
 	ObjectManager(const ObjectManager&) = delete;
 	ObjectManager& operator=(const ObjectManager&) = delete;
 
+private:
+	// o^ς݂̌^
+	struct TypeEntry
+	{
+		std::string name;							// ^itypeid  nameAvt@C̃L[j
+		size_t defaultReserve = 0;					// vt@CɋL^Ƃ̎O
+		std::function<size_t(size_t)> reserve;		// ̐ count ܂ŎO
+		ObjectPool::CreateFn create;				// ̐1i[pA[J[XbhĂ΂j
+	};
+
+	// vt@Ct@C̎ʎqƃo[W
+	static const uint32_t ProfileMagic = 0x46505050; // 'PPPF'
+	static const uint32_t ProfileVersion = 1;
+
 private:
 	ObjectPool m_pool; // IuWFNgv[
+	std::vector<TypeEntry> m_types; // ^IDƂ̓o^iCXbĥݐGj
+	std::unordered_map<std::string, size_t> m_profile; // ^ -> O܂ł̍ő哯gp
+	std::string m_profilePath; // ClearAll Ƀvt@CopXiȂ珑oȂj
+	uint32_t m_sceneArena = 0; // ݂̃V[̃A[iIDiRegisterCurrentScene Ő؂ւj
+
+	std::mutex m_pendingMutex; // \L[p~[ebNX
+	std::vector<ObjectHandle> m_pendingReleases; // \L[iFlushReleases ŋɂȂj
+	std::vector<ObjectHandle> m_flushBuffer; // FlushReleases ̍Ɨpit[̊mۂ邽ߎg񂷁j
 };
\ No newline at end of file
@@ -1,21 +1,60 @@
 #include "ObjectPool.h"
 #include <algorithm>
+#include <cstring>
 
 // ev[gֈړ
 
-std::shared_ptr<GameObject> ObjectPool::Get(ObjectHandle handle)
+std::shared_ptr<GameObject> ObjectPool::Get(ObjectHandle handle) const
+{
+	uint32_t typeId = 0;
+	return LoadLive(handle, typeId);
+}
+
+std::shared_ptr<GameObject> ObjectPool::LoadLive(ObjectHandle handle, uint32_t& outTypeId) const
 {
 	if (m_shuttingDown.load(std::memory_order_acquire)) {
 		return nullptr;
 	}
-	ObjectPool::ActivityGuard ag(m_activeOps);
+	if (!handle.IsValid()) return nullptr;
+	if (handle.index >= SlotCount()) return nullptr; // Jς݂̃XbĝݎQƂ
 
-	std::lock_guard<std::mutex> lk(m_mutex);
+	const Slot& slot = SlotAt(handle.index);
+
+	// JԂŐEgpE^^O𔻒肵Ă̂ǂ
+	const uint64_t before = slot.state.load(std::memory_order_acquire);
+	if (!StateMatches(before, handle)) return nullptr;
+
+	std::shared_ptr<GameObject> obj = std::atomic_load(&slot.obj);
+
+	// ǂݎ蒆ɉE㏑Ă疳iオiނ̂ŏԂςj
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (slot.state.load(std::memory_order_relaxed) != before) return nullptr;
+
+	outTypeId = static_cast<uint32_t>((before >> 24) & 0xFFu);
+	return obj;
+}
+
+GameObject* ObjectPool::LoadLiveRaw(ObjectHandle handle, uint32_t& outTypeId) const
+{
+	if (m_shuttingDown.load(std::memory_order_acquire)) {
+		return nullptr;
+	}
+	if (!handle.IsValid()) return nullptr;
+	if (handle.index >= SlotCount()) return nullptr;
+
+	const Slot& slot = SlotAt(handle.index);
+
+	// LoadLive Ɠ菇ŁÂ raw ǂ
+	const uint64_t before = slot.state.load(std::memory_order_acquire);
+	if (!StateMatches(before, handle)) return nullptr;
+
+	GameObject* obj = slot.raw.load(std::memory_order_acquire);
 
-	if (!IsHandleValid_NoLock(handle)) return nullptr;
-	Slot& slot = m_slots[handle.index];
-	slot.lastUsed = std::chrono::steady_clock::now();
-	return slot.obj;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (slot.state.load(std::memory_order_relaxed) != before) return nullptr;
+
+	outTypeId = static_cast<uint32_t>((before >> 24) & 0xFFu);
+	return obj;
 }
 
 bool ObjectPool::Release(ObjectHandle handle)
@@ -28,22 +67,69 @@ bool ObjectPool::Release(ObjectHandle handle)
 	ObjectPool::ActivityGuard ag(m_activeOps); // ANeBuK[h
 
 	std::lock_guard<std::mutex> lk(m_mutex); // bN擾
+	return ReleaseSlot_NoLock(handle);
+}
+
+size_t ObjectPool::ReleaseN(const ObjectHandle* handles, size_t count)
+{
+	if (count == 0 || handles == nullptr) return 0;
 
-	// L`FbN
+	// Vbg_E̓[X
+	if (m_shuttingDown.load(std::memory_order_acquire)) {
+		DebugLogFmt("[ObjectPool] ReleaseN refused: shutting down count=%zu\n", count);
+		return 0;
+	}
+	ObjectPool::ActivityGuard ag(m_activeOps);
+
+	std::lock_guard<std::mutex> lk(m_mutex); // bN͂܂Ƃ߂1
+	size_t released = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (ReleaseSlot_NoLock(handles[i])) ++released;
+	}
+	return released;
+}
+
+bool ObjectPool::ReleaseSlot_NoLock(ObjectHandle handle)
+{
+	// ҂̃Xbg͊i[ɉ
+	if (handle.IsValid() && handle.index < SlotCount()) {
+		Slot& pending = SlotAt(handle.index);
+		if (pending.pending && pending.generation == handle.generation && !pending.releaseOnCommit) {
+			pending.releaseOnCommit = true;
+			DebugLogFmt("[ObjectPool] Release idx=%u deferred until build completes\n", handle.index);
+			return true;
+		}
+	}
+
+	// L`FbNinh2nꂽꍇŒej
 	if (!IsHandleValid_NoLock(handle)) {
 		DebugLogFmt("[ObjectPool] Release INVALID handle idx=%u gen=%u\n", handle.index, handle.generation);
 		return false;
 	}
 
 	// XbgԂɂ
-	Slot& slot = m_slots[handle.index];
+	Slot& slot = SlotAt(handle.index);
+	m_invalidations.fetch_add(1, std::memory_order_release);
 	slot.inUse = false;
-	slot.lastUsed = std::chrono::steady_clock::now();
-	++slot.generation;
-	// freeIndices ɏdēȂ悤Ƀ`FbNĂǉ
-	if (std::find(m_freeIndices.begin(), m_freeIndices.end(), handle.index) == m_freeIndices.end()) {
-		m_freeIndices.push_back(handle.index);
-		DebugLogFmt("[ObjectPool] Release idx=%u newGen=%u freeCount=%zu\n", handle.index, slot.generation, m_freeIndices.size());
+	slot.lastUsedFrame = m_frame;
+	AdvanceGeneration(slot);
+	PublishState_NoLock(slot); // ǂݎ葤猩Ėɂ
+	if (m_activeByType[slot.typeId] > 0) --m_activeByType[slot.typeId];
+	++m_statsByType[slot.typeId].releases;
+	RemoveLive_NoLock(handle.index);
+
+	// \Z̋󂫂҂Ă擾΋N
+	if (m_budgetWaiters > 0) m_budgetCv.notify_all();
+
+	// 󂫃XgɏdēȂ悤Ƀ`FbNĂǉi̓Xbg̈ʒu O(1) j
+	const std::vector<uint32_t>& freeList = slot.obj ? m_freeByType[slot.typeId] : m_emptyIndices;
+	if (slot.freeListPos == NotInList) {
+		PushFree_NoLock(handle.index);
+		// IuWFNgێ܂ܑҋ@Xbg CleanupIdleStep ̑ΏۂƂĎɐς
+		if (slot.obj && !slot.prewarmed) {
+			m_idleQueue.push_back(IdleEntry{ handle.index, slot.generation, m_frame, m_frameSeconds });
+		}
+		DebugLogFmt("[ObjectPool] Release idx=%u newGen=%u typeFree=%zu\n", handle.index, slot.generation, freeList.size());
 	}
 	else {
 		DebugLogFmt("[ObjectPool] Release idx=%u already free (gen=%u)\n", handle.index, slot.generation);
@@ -56,6 +142,15 @@ void ObjectPool::ClearAll()
 	// Vbg_EJn錾
 	m_shuttingDown.store(true, std::memory_order_release);
 
+	// \Z̋󂫂҂Ă擾Niҋ@̓bNŃtOĂ҂̂ŁAbN߂Ύ肱ڂȂj
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+	}
+	m_budgetCv.notify_all();
+
+	// [J[Xbh~߂ï˗Î҂Ä˗͎̂Ăj
+	StopWorker();
+
 	// ANeBu삪Î҂iZԂ̃Xsj
 	const int maxWaitMs = 5000;
 	int waited = 0;
@@ -69,109 +164,952 @@ void ObjectPool::ClearAll()
 
 	// NA
 	std::lock_guard<std::mutex> lk(m_mutex);
+	m_invalidations.fetch_add(1, std::memory_order_release);
 
-	for (auto& s : m_slots) // SXbg𑖍
+	const uint32_t slotCount = SlotCount();
+	for (uint32_t i = 0; i < slotCount; ++i) // SXbg𑖍
 	{
+		Slot& s = SlotAt(i);
 		// ۂɃIuWFNg݂Ă폜JEg𑝂₷
 		if (s.obj) {
 			++m_totalDeleted;
 		}
-		s.obj.reset();
+		ExchangeObject_NoLock(s, std::shared_ptr<GameObject>());
+		s.typeId = 0;
 		s.inUse = false;
-		++s.generation;
-		s.lastUsed = std::chrono::steady_clock::now();
+		s.prewarmed = false;
+		s.livePos = NotInList;
+		s.sceneId = 0;
+		s.pending = false;
+		s.releaseOnCommit = false;
+		AdvanceGeneration(s);
+		PublishState_NoLock(s);
+		s.lastUsedFrame = m_frame;
 	}
 
-	m_freeIndices.clear();
+	// SXbgIuWFNgێ̋󂫃Xg
+	for (auto& list : m_freeByType) list.clear();
+	m_idleQueue.clear();
+	m_retired.clear();
+	m_built.clear();
+	for (auto& refill : m_refill) refill.inFlight = 0;
+	for (auto& live : m_liveByType) { live.indices.clear(); live.objects.clear(); }
+	std::fill(m_activeByType.begin(), m_activeByType.end(), 0);
+	std::fill(m_reservedByType.begin(), m_reservedByType.end(), 0); // [J[͎~߂ĂA̎擾IĂ
+	m_emptyIndices.clear();
 
-	for (uint32_t i = 0; i < m_slots.size(); ++i) m_freeIndices.push_back(i);
+	for (uint32_t i = 0; i < slotCount; ++i) {
+		SlotAt(i).freeListPos = NotInList;
+		PushFree_NoLock(i);
+	}
 }
 
 size_t ObjectPool::CleanupIdle(double maxIdleSeconds)
 {
+	// ȂŊ؂ׂď
+	return CleanupIdleStep(maxIdleSeconds, SIZE_MAX, 0.0);
+}
+
+size_t ObjectPool::CleanupIdleStep(double maxIdleSeconds, size_t maxSlotsPerCall, double maxMicros)
+{
+	IdleLimit limit;
+	limit.seconds = maxIdleSeconds;
+	return CleanupIdle_Impl(limit, maxSlotsPerCall, maxMicros);
+}
+
+size_t ObjectPool::CleanupIdleStepFrames(uint64_t maxIdleFrames, size_t maxSlotsPerCall, double maxMicros)
+{
+	IdleLimit limit;
+	limit.byFrames = true;
+	limit.frames = maxIdleFrames;
+	return CleanupIdle_Impl(limit, maxSlotsPerCall, maxMicros);
+}
+
+void ObjectPool::AdvanceFrame(double deltaSeconds)
+{
+	// Õt[ŎIuWFNgoAbNOŔjifXgN^ Release ōēȂ悤Ɂj
+	std::vector<std::shared_ptr<GameObject>> retired;
+	std::vector<BuildJob> jobs;
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		++m_frame;
+		if (deltaSeconds > 0.0) m_frameSeconds += deltaSeconds;
+		retired.swap(m_retired);
+
+		// [J[XbhŐÎi[A[̈˗iVbg_E͍sȂj
+		if (!m_shuttingDown.load(std::memory_order_acquire)) {
+			CommitBuilt_NoLock();
+			CollectRefillJobs_NoLock(jobs);
+
+			// ΂炭XbgĂȂΖ̋󂫂l߂
+			if (m_autoCompact && m_frame - m_lastGrowFrame >= m_compactQuietFrames) Compact_NoLock(0);
+		}
+	}
+	retired.clear();
+	if (!jobs.empty()) PushJobs(jobs);
+}
+
+void ObjectPool::SetRefill(uint32_t typeId, size_t lowWater, size_t target, CreateFn create)
+{
+	if (typeId == 0 || typeId > ObjectTypeId::MaxTypeId) return;
+	std::lock_guard<std::mutex> lk(m_mutex);
+	EnsureTypeTables_NoLock(typeId);
+	if (typeId >= m_refill.size()) m_refill.resize(typeId + 1);
+
+	RefillEntry& refill = m_refill[typeId];
+	refill.lowWater = lowWater;
+	refill.target = target;
+	refill.create = std::move(create);
+}
+
+bool ObjectPool::IsPending(ObjectHandle handle) const
+{
+	if (!handle.IsValid() || handle.index >= SlotCount()) return false;
+	std::lock_guard<std::mutex> lk(m_mutex);
+	const Slot& slot = SlotAt(handle.index);
+	return slot.pending && slot.generation == handle.generation;
+}
+
+uint32_t ObjectPool::ReservePending_NoLock(uint32_t typeId)
+{
+	++m_reservedByType[typeId];
+	const uint32_t idx = m_emptyIndices.empty() ? AppendSlot_NoLock() : PopFree_NoLock(m_emptyIndices);
+	Slot& slot = SlotAt(idx);
+	slot.inUse = true; // Ȃ悤ɗ\iJԂ͊i[܂Ŗ̂܂܁j
+	slot.pending = true;
+	slot.releaseOnCommit = false;
+	slot.sceneId = 0;
+	slot.lastUsedFrame = m_frame;
+	return idx;
+}
+
+void ObjectPool::CommitBuilt_NoLock()
+{
+	for (BuiltObject& built : m_built)
+	{
+		// \񂵂_琔Ă̕Oii[͎gpEҋ@ƂĐj
+		if (m_reservedByType[built.typeId] > 0) --m_reservedByType[built.typeId];
+
+		// ̃Xbg Compact Ŏ菜ȂAClearAll Ɏ菜ĂΎ̂Ă
+		if (built.index >= SlotCount()) {
+			Retire_NoLock(std::move(built.obj));
+			continue;
+		}
+		Slot& slot = SlotAt(built.index);
+		if (built.refill && built.typeId < m_refill.size() && m_refill[built.typeId].inFlight > 0) {
+			--m_refill[built.typeId].inFlight;
+		}
+
+		// ˗ ClearAll ȂǂŃXbg蒼Ă̂Ă
+		if (!slot.pending || slot.generation != built.generation) {
+			Retire_NoLock(std::move(built.obj));
+			continue;
+		}
+		slot.pending = false;
+		const bool releaseNow = slot.releaseOnCommit;
+		slot.releaseOnCommit = false;
+
+		// Ɏs疢ێ̋󂫂֖߂i\Z󂭂̂ő҂ĂXbhɒm点j
+		if (!built.obj) {
+			slot.inUse = false;
+			PublishState_NoLock(slot);
+			PushFree_NoLock(built.index);
+			if (m_budgetWaiters > 0) m_budgetCv.notify_all();
+			continue;
+		}
+
+		++m_totalCreated;
+		ExchangeObject_NoLock(slot, std::move(built.obj)); // \񂵂Xbg͖ێȂ̂Ō͖̎̂
+		slot.typeId = built.typeId;
+		slot.lastUsedFrame = m_frame;
+
+		// [͑ҋ@ԂŊi[iInitObject ͎擾ɌĂ΂j
+		if (built.refill) {
+			++m_statsByType[built.typeId].prebuilt;
+			slot.inUse = false;
+			slot.prewarmed = true;
+			PublishState_NoLock(slot);
+			PushFree_NoLock(built.index);
+			continue;
+		}
+
+		slot.prewarmed = false;
+		slot.sceneId = m_sceneArena;
+		NoteAcquired_NoLock(built.index);
+		try {
+			slot.obj->InitObject();
+		}
+		catch (...) {
+			DebugLogFmt("[ObjectPool] Exception during InitObject on async build idx=%u\n", built.index);
+		}
+		PublishState_NoLock(slot);
+		if (releaseNow) ReleaseSlot_NoLock(ObjectHandle(built.index, built.generation, built.typeId));
+	}
+	m_built.clear();
+}
+
+void ObjectPool::CollectRefillJobs_NoLock(std::vector<BuildJob>& jobs)
+{
+	for (uint32_t typeId = 1; typeId < m_refill.size(); ++typeId)
+	{
+		RefillEntry& refill = m_refill[typeId];
+		if (refill.lowWater == 0 || !refill.create) continue;
+
+		// ҋ@Ɛ킹ĉĂȂΉȂ
+		const size_t available = m_freeByType[typeId].size() + refill.inFlight;
+		if (available >= refill.lowWater) continue;
+
+		const size_t target = (std::max)(refill.target, refill.lowWater);
+		for (size_t n = available; n < target; ++n)
+		{
+			if (CheckBudget_NoLock(typeId, 0) != BudgetCheck::Fits) break; // \Z𒴂镪͕[Ȃi͐̕Ăj
+			BuildJob job;
+			job.index = ReservePending_NoLock(typeId);
+			job.generation = SlotAt(job.index).generation;
+			job.typeId = typeId;
+			job.refill = true;
+			job.create = refill.create;
+			jobs.push_back(std::move(job));
+			++refill.inFlight;
+		}
+		DebugLogFmt("[ObjectPool] Refill type=%s idle=%zu inFlight=%zu\n", ObjectTypeId::NameOf(typeId), m_freeByType[typeId].size(), refill.inFlight);
+	}
+}
+
+void ObjectPool::PushJobs(std::vector<BuildJob>& jobs)
+{
+	{
+		std::lock_guard<std::mutex> lk(m_jobMutex);
+		if (m_workerStop) return; // ~̈˗͎󂯕tȂi\񂵂Xbg ClearAll Ŗ߂j
+		if (!m_worker.joinable()) {
+			m_worker = std::thread(&ObjectPool::WorkerLoop, this);
+		}
+		for (BuildJob& job : jobs) m_jobs.push_back(std::move(job));
+	}
+	m_jobCv.notify_one();
+}
+
+void ObjectPool::WorkerLoop()
+{
+	for (;;)
+	{
+		BuildJob job;
+		{
+			std::unique_lock<std::mutex> lk(m_jobMutex);
+			m_jobCv.wait(lk, [this] { return m_workerStop || !m_jobs.empty(); });
+			if (m_workerStop) return;
+			job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+
+		// bNɐ
+		std::shared_ptr<GameObject> obj;
+		try {
+			obj = job.create();
+		}
+		catch (...) {
+			DebugLogFmt("[ObjectPool] Exception during async build idx=%u\n", job.index);
+		}
+
+		// i[͎ AdvanceFrame ŃCXbhs
+		std::lock_guard<std::mutex> lk(m_mutex);
+		m_built.push_back(BuiltObject{ job.index, job.generation, job.typeId, job.refill, std::move(obj) });
+	}
+}
+
+void ObjectPool::StopWorker()
+{
+	{
+		std::lock_guard<std::mutex> lk(m_jobMutex);
+		m_workerStop = true;
+		m_jobs.clear();
+	}
+	m_jobCv.notify_all();
+	if (m_worker.joinable()) m_worker.join();
+}
+
+uint64_t ObjectPool::CurrentFrame() const
+{
+	return m_frame.load(std::memory_order_relaxed);
+}
+
+void ObjectPool::SetTypeBudget(uint32_t typeId, const Budget& budget)
+{
+	if (typeId == 0 || typeId > ObjectTypeId::MaxTypeId) return;
+	std::lock_guard<std::mutex> lk(m_mutex);
+	if (typeId >= m_typeBudgets.size()) m_typeBudgets.resize(typeId + 1);
+	m_typeBudgets[typeId] = budget;
+	m_hasBudget = true;
+}
+
+void ObjectPool::SetGlobalBudget(const Budget& budget)
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	m_globalBudget = budget;
+	m_hasBudget = true;
+}
+
+size_t ObjectPool::HeldBytes() const
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	size_t bytes = 0;
+	for (uint32_t typeId = 1; typeId < m_freeByType.size(); ++typeId) {
+		bytes += HeldCount_NoLock(typeId) * ObjectTypeId::SizeOf(typeId);
+	}
+	return bytes;
+}
+
+ObjectPool::BudgetCheck ObjectPool::CheckBudget_NoLock(uint32_t typeId, size_t extra) const
+{
+	if (!m_hasBudget) return BudgetCheck::Fits;
+	const size_t adding = extra + 1;
+	const size_t size = ObjectTypeId::SizeOf(typeId);
+
+	if (typeId < m_typeBudgets.size()) {
+		const Budget& budget = m_typeBudgets[typeId];
+		const size_t held = HeldCount_NoLock(typeId) + adding;
+		if ((budget.maxCount != 0 && held > budget.maxCount) || (budget.maxBytes != 0 && held * size > budget.maxBytes)) {
+			return BudgetCheck::OverType;
+		}
+	}
+
+	if (m_globalBudget.maxCount != 0 || m_globalBudget.maxBytes != 0) {
+		// ^̎ނ͏Ȃ̂Ō^e[uv
+		size_t count = adding;
+		size_t bytes = adding * size;
+		for (uint32_t t = 1; t < m_freeByType.size(); ++t) {
+			const size_t held = HeldCount_NoLock(t);
+			count += held;
+			bytes += held * ObjectTypeId::SizeOf(t);
+		}
+		if ((m_globalBudget.maxCount != 0 && count > m_globalBudget.maxCount) || (m_globalBudget.maxBytes != 0 && bytes > m_globalBudget.maxBytes)) {
+			return BudgetCheck::OverGlobal;
+		}
+	}
+	return BudgetCheck::Fits;
+}
+
+bool ObjectPool::MakeRoom_NoLock(std::unique_lock<std::mutex>& lk, uint32_t typeId, size_t extra)
+{
+	if (!m_hasBudget) return true;
+
+	std::chrono::steady_clock::time_point start; // ҂n߂̎iۂɑ҂Ƃvǂށj
+	bool timedOut = false;
+	bool waited = false;
+	for (;;)
+	{
+		if (m_shuttingDown.load(std::memory_order_acquire)) return false;
+		if (!m_freeByType[typeId].empty()) return true; // ҂ĂԂɓ^ꂽ
+
+		const BudgetCheck check = CheckBudget_NoLock(typeId, extra);
+		if (check == BudgetCheck::Fits) return true;
+
+		// Ŝ̗\ŹAłOɉꂽҋ@CX^Xjċ󂯂i^̗\Z͓^̑ҋ@̂ŋ󂯂Ȃj
+		if (check == BudgetCheck::OverGlobal && EvictLruIdle_NoLock()) continue;
+		if (timedOut) return false;
+
+		const Budget& budget = check == BudgetCheck::OverType ? m_typeBudgets[typeId] : m_globalBudget;
+		switch (budget.policy)
+		{
+		case CapPolicy::RecycleOldest:
+			return RecycleOldest_NoLock(typeId);
+
+		case CapPolicy::Block:
+		{
+			if (!waited) start = std::chrono::steady_clock::now();
+			waited = true;
+			const auto deadline = start + std::chrono::milliseconds(budget.blockTimeoutMs);
+			++m_budgetWaiters;
+			timedOut = m_budgetCv.wait_until(lk, deadline) == std::cv_status::timeout;
+			--m_budgetWaiters;
+			break; // x肷i^CAEgxj
+		}
+
+		case CapPolicy::Fail:
+		default:
+			return false;
+		}
+	}
+}
+
+bool ObjectPool::EvictLruIdle_NoLock()
+{
+	// ҋ@L[͉Ȃ̂ŁA擪LȃGgTiOQƂcĂ͖̂։񂷁j
+	for (size_t examined = m_idleQueue.size(); examined > 0 && !m_idleQueue.empty(); --examined)
+	{
+		const IdleEntry entry = m_idleQueue.front();
+		m_idleQueue.pop_front();
+		if (entry.index >= SlotCount()) continue;
+		Slot& slot = SlotAt(entry.index);
+		if (slot.inUse || slot.generation != entry.generation || !slot.obj || slot.prewarmed) continue;
+		if (slot.obj.use_count() > 1) {
+			m_idleQueue.push_back(entry);
+			continue;
+		}
+		EvictIdleSlot_NoLock(entry.index);
+		return true;
+	}
+
+	// ҋ@L[ɖΎOiłOɎgꂽ́jj
+	uint32_t oldest = NotInList;
+	for (const auto& list : m_freeByType) {
+		for (uint32_t index : list) {
+			const Slot& slot = SlotAt(index);
+			if (slot.obj.use_count() > 1) continue;
+			if (oldest == NotInList || slot.lastUsedFrame < SlotAt(oldest).lastUsedFrame) oldest = index;
+		}
+	}
+	if (oldest == NotInList) return false;
+	EvictIdleSlot_NoLock(oldest);
+	return true;
+}
+
+void ObjectPool::EvictIdleSlot_NoLock(uint32_t index)
+{
+	Slot& slot = SlotAt(index);
+
+	// ^ʂ̋󂫃XgOiʒuĂ̂ŒTsvj
+	RemoveFromFreeList_NoLock(m_freeByType[slot.typeId], index);
+
+	++m_totalDeleted;               // 폜JEg̓bNő₷
+	++m_statsByType[slot.typeId].evictions;
+	Retire_NoLock(ExchangeObject_NoLock(slot, std::shared_ptr<GameObject>())); // j͎ AdvanceFrame ōs
+	slot.typeId = 0;
+	slot.sceneId = 0;
+	slot.prewarmed = false;
+	AdvanceGeneration(slot);
+	PublishState_NoLock(slot);
+
+	// IuWFNgێɂȂ̂ŖێXg
+	PushFree_NoLock(index);
+	if (m_budgetWaiters > 0) m_budgetCv.notify_all();
+}
+
+bool ObjectPool::RecycleOldest_NoLock(uint32_t typeId)
+{
+	const LiveList& live = m_liveByType[typeId];
+	if (live.indices.empty()) return false;
+
+	// 擾t[łÂ̂I
+	uint32_t oldest = live.indices[0];
+	for (uint32_t index : live.indices) {
+		if (SlotAt(index).lastUsedFrame < SlotAt(oldest).lastUsedFrame) oldest = index;
+	}
+	const Slot& slot = SlotAt(oldest);
+	DebugLogFmt("[ObjectPool] Recycle oldest idx=%u type=%s\n", oldest, ObjectTypeId::NameOf(typeId));
+	return ReleaseSlot_NoLock(ObjectHandle(oldest, slot.generation, typeId));
+}
+
+size_t ObjectPool::Compact(uint32_t minSlots)
+{
+	if (m_shuttingDown.load(std::memory_order_acquire)) return 0;
+	ObjectPool::ActivityGuard ag(m_activeOps);
+	std::lock_guard<std::mutex> lk(m_mutex);
+	return Compact_NoLock(minSlots);
+}
+
+void ObjectPool::SetAutoCompact(bool enabled, uint64_t quietFrames)
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	m_autoCompact = enabled;
+	m_compactQuietFrames = quietFrames;
+}
+
+size_t ObjectPool::Compact_NoLock(uint32_t minSlots)
+{
+	const uint32_t oldCount = SlotCount();
+	uint32_t newCount = oldCount;
+
+	// Agpi\E܂ށjłIuWFNgێłȂXbgOĂ
+	while (newCount > minSlots)
+	{
+		const uint32_t index = newCount - 1;
+		Slot& slot = SlotAt(index);
+		if (slot.inUse || slot.obj || slot.pending) break;
+		RemoveFromFreeList_NoLock(m_emptyIndices, index);
+		--newCount;
+	}
+	if (newCount == oldCount) return 0;
+
+	// 炷iȍ~ɓǂݎn߂ǂݎ葤͐VȏȂj
+	// Âǂ񂾃bN̓ǂݎ葤܂G邩Ȃ̂ŁA`N̓e[uɎcĉȂ
+	m_slotCount.store(newCount, std::memory_order_release);
+	DebugLogFmt("[ObjectPool] Compact slots=%u -> %u\n", oldCount, newCount);
+	return oldCount - newCount;
+}
+
+uint32_t ObjectPool::BeginSceneArena()
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	m_lastSceneArena = (m_lastSceneArena + 1 == 0) ? 1 : m_lastSceneArena + 1; // 0 ́uV[ɑȂvȂ̂Ŕ΂
+	m_sceneArena = m_lastSceneArena;
+	return m_sceneArena;
+}
+
+size_t ObjectPool::EndSceneArena(uint32_t sceneId)
+{
+	if (sceneId == 0) return 0;
 	if (m_shuttingDown.load(std::memory_order_acquire)) {
 		return 0;
 	}
 	ObjectPool::ActivityGuard ag(m_activeOps);
 
+	std::lock_guard<std::mutex> lk(m_mutex);
+	if (m_sceneArena == sceneId) m_sceneArena = 0;
+
+	// 1 Release  CleanupIdle ŌォjAł͂ȂA1̑ł܂Ƃ߂ĕЕt
+	size_t destroyed = 0;
+	const uint32_t slotCount = SlotCount();
+	for (uint32_t i = 0; i < slotCount; ++i)
+	{
+		Slot& slot = SlotAt(i);
+		if (slot.sceneId != sceneId) continue;
+		slot.sceneId = 0;
+		if (!slot.obj) continue;
+
+		// gp̂܂܎cĂ͉̂ɂinh͐オiŖɂȂj
+		if (slot.inUse) {
+			m_invalidations.fetch_add(1, std::memory_order_release);
+			slot.inUse = false;
+			slot.lastUsedFrame = m_frame;
+			AdvanceGeneration(slot);
+			if (m_activeByType[slot.typeId] > 0) --m_activeByType[slot.typeId];
+			RemoveLive_NoLock(i);
+		}
+
+		// O̓V[܂ŎĝŔjҋ@ɖ߂
+		if (slot.prewarmed) {
+			PublishState_NoLock(slot);
+			if (slot.freeListPos == NotInList) PushFree_NoLock(i);
+			continue;
+		}
+
+		// ^ʂ̋󂫃XgɓĂΊOÂĖێXgցiҋ@L[̃Gg͐̕svŎ̂Ăj
+		RemoveFromFreeList_NoLock(m_freeByType[slot.typeId], i);
+		++m_totalDeleted;
+		++m_statsByType[slot.typeId].evictions;
+		Retire_NoLock(ExchangeObject_NoLock(slot, std::shared_ptr<GameObject>()));
+		slot.typeId = 0;
+		AdvanceGeneration(slot);
+		PublishState_NoLock(slot);
+		PushFree_NoLock(i);
+		++destroyed;
+	}
+	DebugLogFmt("[ObjectPool] EndSceneArena id=%u destroyed=%zu\n", sceneId, destroyed);
+
+	// V[ؑւׂ͕؂Ȃ̂ŁA󂢂ŋl߂
+	if (m_autoCompact) Compact_NoLock(0);
+	return destroyed;
+}
+
+size_t ObjectPool::CleanupIdle_Impl(const IdleLimit& limit, size_t maxSlotsPerCall, double maxMicros)
+{
+	if (m_shuttingDown.load(std::memory_order_acquire)) {
+		return 0;
+	}
+	ObjectPool::ActivityGuard ag(m_activeOps);
+
+	// Ԃ̗\Z̓N[AbvŌviGet Ȃǂ̎QƌoHł͎vǂ܂Ȃj
 	using Clock = std::chrono::steady_clock;
-	auto now = Clock::now();
+	const auto start = maxMicros > 0.0 ? Clock::now() : Clock::time_point();
+	const auto timeLimit = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::micro>(maxMicros));
 
-	// j̓bNOōs߂̎WXg
-	std::vector<std::shared_ptr<GameObject>> toDestroy;
 	size_t removed = 0;
 
 	{
 		std::lock_guard<std::mutex> lk(m_mutex);
 
-		for (uint32_t i = 0; i < m_slots.size(); ++i)
+		// ҋ@L[͉i= jȂ̂ŁA擪؂̂̂
+		// ɉ񂵒Gg𓯂ĂяoōēxȂ悤AJn_̌܂łɐ
+		const size_t budget = (std::min)(maxSlotsPerCall, m_idleQueue.size());
+		size_t examined = 0;
+		while (!m_idleQueue.empty() && examined < budget)
 		{
-			Slot& slot = m_slots[i];
-			if (slot.inUse) continue;				// gp̓XLbv
-			if (!slot.obj) continue;				// IuWFNg݂Ȃꍇ̓XLbv
-			if (slot.obj.use_count() > 1) continue;	// OQƂꍇ̓XLbv
-
-			// AChԌvZ
-			auto idle = std::chrono::duration_cast<std::chrono::duration<double>>(now - slot.lastUsed).count();
-
-			// wbȏAChȂƂĔoił actual reset ͍sȂj
-			if (idle >= maxIdleSeconds)
-			{
-				++m_totalDeleted;               // 폜JEg̓bNő₷
-				toDestroy.push_back(std::move(slot.obj)); // slot.obj [uăbNOŔj
-				++slot.generation;
-				// freeIndices ɓĂȂΒǉidrj
-				if (std::find(m_freeIndices.begin(), m_freeIndices.end(), i) == m_freeIndices.end())
-				{
-					m_freeIndices.push_back(i); // 󂫃Xgɒǉ
-				}
-				++removed;
-				// slot.obj ̓[u nullptr ɂȂĂ
+			// ԗ\Z̊mFiv̎擾炷ߐƁj
+			if (maxMicros > 0.0 && (examined & 15) == 15 && Clock::now() - start >= timeLimit) break;
+			++examined;
+
+			const IdleEntry entry = m_idleQueue.front();
+
+			// Compact Ŏ菜ꂽXbg̃Gĝ͎Ă
+			if (entry.index >= SlotCount()) {
+				m_idleQueue.pop_front();
+				continue;
+			}
+			Slot& slot = SlotAt(entry.index);
+
+			// ėpEjEO̕یȂǂŖɂȂGĝ͎Ă
+			if (slot.inUse || slot.generation != entry.generation || !slot.obj || slot.prewarmed) {
+				m_idleQueue.pop_front();
+				continue;
 			}
+
+			// 擪܂ȂAȍ~it[܂ AdvanceFrame ŐώZbŔj
+			const bool expired = limit.byFrames
+				? (m_frame - entry.releasedFrame >= limit.frames)
+				: (m_frameSeconds - entry.releasedSeconds >= limit.seconds);
+			if (!expired) break;
+			m_idleQueue.pop_front();
+
+			// OQƂꍇ͍͉AL[̖ɉ񂵂ČŊmF
+			if (slot.obj.use_count() > 1) {
+				m_idleQueue.push_back(IdleEntry{ entry.index, entry.generation, m_frame, m_frameSeconds });
+				continue;
+			}
+
+			EvictIdleSlot_NoLock(entry.index);
+			++removed;
 		}
 	} // lk 
 
-	//  toDestroy  shared_ptr XR[vŔjƎۂ̃fXgN^ibNȂj
-	toDestroy.clear();
-
 	return removed;
 }
 
-bool ObjectPool::IsHandleValid(ObjectHandle handle)
+size_t ObjectPool::Snapshot(std::vector<uint8_t>& buffer) const
 {
-	// allow during shutdown (reads only)
+	// gp̃Xbg^ʂ̐XgW߂î AdvanceFrame ܂ŔjȂ̂ŁAo̓bNOōsj
+	std::vector<std::pair<ObjectHandle, GameObject*>> live;
+	std::vector<uint32_t> types;
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		for (uint32_t typeId = 1; typeId < m_liveByType.size(); ++typeId)
+		{
+			const LiveList& list = m_liveByType[typeId];
+			if (list.indices.empty()) continue;
+			types.push_back(typeId);
+			for (size_t i = 0; i < list.indices.size(); ++i) {
+				const uint32_t index = list.indices[i];
+				live.emplace_back(ObjectHandle(index, SlotAt(index).generation, typeId), list.objects[i]);
+			}
+		}
+	}
+
+	SnapshotWriter out(buffer);
+	out.Write(static_cast<uint32_t>(SnapshotMagic));
+	out.Write(static_cast<uint32_t>(SnapshotVersion));
+
+	// ^̕\iRestore Ō^ID^wĂ邩ƍj
+	out.Write(static_cast<uint32_t>(types.size()));
+	for (uint32_t typeId : types) {
+		const char* name = ObjectTypeId::NameOf(typeId);
+		const uint16_t nameLen = static_cast<uint16_t>(std::strlen(name));
+		out.Write(typeId);
+		out.Write(nameLen);
+		out.WriteBytes(name, nameLen);
+	}
+
+	out.Write(static_cast<uint32_t>(live.size()));
+	for (const auto& entry : live)
+	{
+		GameObject* obj = entry.second;
+		std::shared_ptr<Transform> transform = obj->GetTransform();
+		out.Write(entry.first.ToUint64());
+		out.Write(transform->GetPosition());
+		out.Write(transform->GetRotation());
+		out.Write(transform->GetScale());
+
+		// ^Ƃ̏Ԃ̓TCYtŏiǂݖ߂Ŕ͈͊Oǂ܂Ȃ悤Ɂj
+		const size_t sizePos = out.Size();
+		out.Write(static_cast<uint32_t>(0));
+		obj->Serialize(out);
+		out.WriteAt(sizePos, static_cast<uint32_t>(out.Size() - sizePos - sizeof(uint32_t)));
+	}
+	DebugLogFmt("[ObjectPool] Snapshot objects=%zu bytes=%zu\n", live.size(), buffer.size());
+	return live.size();
+}
+
+bool ObjectPool::Restore(const uint8_t* data, size_t size, const CreateByTypeFn& create, const std::weak_ptr<SceneBase>& scene, bool* slotsRewritten)
+{
+	if (slotsRewritten) *slotsRewritten = false;
+	if (data == nullptr) return false;
+	if (m_shuttingDown.load(std::memory_order_acquire)) {
+		DebugLogFmt("[ObjectPool] Restore refused: shutting down\n");
+		return false;
+	}
+	ObjectPool::ActivityGuard ag(m_activeOps);
+
+	// 1
+	struct Record
+	{
+		ObjectHandle handle;
+		VECTOR position;
+		VECTOR rotation;
+		VECTOR scale;
+		const uint8_t* payload = nullptr;
+		uint32_t payloadSize = 0;
+		std::shared_ptr<GameObject> created; // 蒼́i̎̂gȂ nullptrj
+		GameObject* object = nullptr;        // ̎
+	};
+
+	// wb_ƌ^̕\mF
+	SnapshotReader in(data, size);
+	uint32_t magic = 0, version = 0, typeCount = 0;
+	if (!in.Read(magic) || !in.Read(version) || magic != SnapshotMagic || version != SnapshotVersion) {
+		DebugLogFmt("[ObjectPool] Restore failed: bad header\n");
+		return false;
+	}
+	if (!in.Read(typeCount)) return false;
+	for (uint32_t i = 0; i < typeCount; ++i)
+	{
+		uint32_t typeId = 0;
+		uint16_t nameLen = 0;
+		if (!in.Read(typeId) || !in.Read(nameLen)) return false;
+		const uint8_t* name = in.ReadBytes(nameLen);
+		if (!name) return false;
+		const char* current = ObjectTypeId::NameOf(typeId);
+		if (std::strlen(current) != nameLen || std::memcmp(current, name, nameLen) != 0) {
+			DebugLogFmt("[ObjectPool] Restore failed: type id %u does not match this process\n", typeId);
+			return false;
+		}
+	}
+
+	// R[hǂށi܂ύXȂj
+	uint32_t recordCount = 0;
+	if (!in.Read(recordCount)) return false;
+	std::vector<Record> records;
+	records.reserve((std::min)(static_cast<size_t>(recordCount), in.Remaining() / sizeof(uint64_t)));
+	for (uint32_t i = 0; i < recordCount; ++i)
+	{
+		Record r;
+		uint64_t packed = 0;
+		if (!in.Read(packed) || !in.Read(r.position) || !in.Read(r.rotation) || !in.Read(r.scale) || !in.Read(r.payloadSize)) return false;
+		r.payload = in.ReadBytes(r.payloadSize);
+		if (!r.payload) return false;
+		r.handle = ObjectHandle::FromUint64(packed);
+		if (r.handle.typeId == 0 || r.handle.index >= SlotChunkSize * MaxSlotChunks) return false;
+		records.push_back(std::move(r));
+	}
+
+	// Xbg2񕜌Ȃi2ڂ̃R[h1ڂ̎̂㏑AXgɂdɓĂ܂j
+	{
+		std::vector<uint32_t> indices;
+		indices.reserve(records.size());
+		for (const Record& r : records) indices.push_back(r.handle.index);
+		std::sort(indices.begin(), indices.end());
+		if (std::adjacent_find(indices.begin(), indices.end()) != indices.end()) {
+			DebugLogFmt("[ObjectPool] Restore failed: duplicate slot index\n");
+			return false;
+		}
+	}
+
+	// 1) ̂蒼KvXbgiێE^ႢEj𒲂ׁAbNOŐ
+	std::vector<size_t> needCreate;
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		for (size_t i = 0; i < records.size(); ++i) {
+			const ObjectHandle h = records[i].handle;
+			if (h.index < SlotCount()) {
+				const Slot& s = SlotAt(h.index);
+				if (s.obj && s.typeId == h.typeId && !s.pending) continue;
+			}
+			needCreate.push_back(i);
+		}
+	}
+	for (size_t i : needCreate) {
+		records[i].created = create ? create(records[i].handle.typeId) : nullptr;
+		if (!records[i].created) {
+			DebugLogFmt("[ObjectPool] Restore failed: cannot create type=%s (not registered?)\n", ObjectTypeId::NameOf(records[i].handle.typeId));
+			return false;
+		}
+	}
+
+	// 2) Xbg\蒼i1̃bNōsj
+	if (slotsRewritten) *slotsRewritten = true;
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+
+		// XibvVbgɖgpXbg
+		std::vector<uint8_t> keep(SlotCount(), 0);
+		for (const Record& r : records) {
+			if (r.handle.index < keep.size()) keep[r.handle.index] = 1;
+		}
+		std::vector<ObjectHandle> toRelease;
+		for (uint32_t typeId = 1; typeId < m_liveByType.size(); ++typeId) {
+			for (uint32_t index : m_liveByType[typeId].indices) {
+				if (!keep[index]) toRelease.push_back(ObjectHandle(index, SlotAt(index).generation, typeId));
+			}
+		}
+		for (ObjectHandle h : toRelease) ReleaseSlot_NoLock(h);
+		m_invalidations.fetch_add(1, std::memory_order_release); // cXbĝς邱Ƃ
+
+		for (Record& r : records)
+		{
+			const uint32_t index = r.handle.index;
+			const uint32_t typeId = r.handle.typeId;
+			while (index >= SlotCount()) {
+				PushFree_NoLock(AppendSlot_NoLock());
+			}
+			EnsureTypeTables_NoLock(typeId);
+			Slot& slot = SlotAt(index);
+
+			// ׂŏԂςĂiXbh̎擾Ȃǁj̃R[h͔΂
+			if (!r.created && (!slot.obj || slot.typeId != typeId || slot.pending)) {
+				DebugLogFmt("[ObjectPool] Restore skipped idx=%u (slot changed)\n", index);
+				continue;
+			}
+
+			// ˗̌ʂ CommitBuilt_NoLock Ŏ̂Ă
+			slot.pending = false;
+			slot.releaseOnCommit = false;
+
+			// 郊XgiXg or 󂫃XgjO
+			if (slot.livePos != NotInList) {
+				if (m_activeByType[slot.typeId] > 0) --m_activeByType[slot.typeId];
+				RemoveLive_NoLock(index);
+			}
+			else {
+				RemoveFromFreeList_NoLock(slot.obj ? m_freeByType[slot.typeId] : m_emptyIndices, index);
+			}
+
+			if (r.created) {
+				if (slot.obj && slot.obj.use_count() == 1) ++m_totalDeleted;
+				++m_totalCreated;
+				Retire_NoLock(ExchangeObject_NoLock(slot, r.created));
+				slot.prewarmed = false;
+			}
+
+			// nhƓE^Ŏgpɂ
+			slot.typeId = typeId;
+			slot.generation = r.handle.generation;
+			slot.inUse = true;
+			slot.sceneId = m_sceneArena;
+			slot.lastUsedFrame = m_frame;
+			NoteAcquired_NoLock(index);
+			PublishState_NoLock(slot);
+			r.object = slot.obj.get();
+		}
+	}
+
+	// 3) bNOŊeIuWFNg̏Ԃ߂iSXbgJȂ̂ŁAtbN瑼̃IuWFNg̃nhj
+	bool ok = true;
+	for (Record& r : records)
+	{
+		if (!r.object) continue;
+
+		// 蒼̂͐֐߂܂ĂV[io^̃V[jw܂܂Ȃ̂ŁÃ݂V[ɕt
+		// iV[݂̃V[łȂ ColliderManager 蔻΂j
+		r.object->SetScene(scene);
+
+		std::shared_ptr<Transform> transform = r.object->GetTransform();
+		transform->SetPosition(r.position);
+		transform->SetRotation(r.rotation);
+		transform->SetScale(r.scale);
+		transform->UpdateMatrix();
+		transform->LocalToWorldMatrix();
+
+		try {
+			if (r.created) r.object->InitObject(); // 蒼̂͒ʏ̎擾ƓtbNĂ
+			SnapshotReader payload(r.payload, r.payloadSize);
+			if (!r.object->Deserialize(payload)) {
+				DebugLogFmt("[ObjectPool] Restore: Deserialize failed idx=%u type=%s\n", r.handle.index, ObjectTypeId::NameOf(r.handle.typeId));
+				ok = false;
+			}
+		}
+		catch (...) {
+			DebugLogFmt("[ObjectPool] Exception during Restore idx=%u\n", r.handle.index);
+			ok = false;
+		}
+	}
+	DebugLogFmt("[ObjectPool] Restore objects=%zu created=%zu\n", records.size(), needCreate.size());
+	return ok;
+}
+
+size_t ObjectPool::ResolveN(const ObjectHandle* handles, size_t count, GameObject** out) const
+{
+	if (handles == nullptr || out == nullptr) return 0;
+	if (m_shuttingDown.load(std::memory_order_acquire)) {
+		std::fill(out, out + count, nullptr);
+		return 0;
+	}
+
+	// bNȂ珑ݑ̒l̂܂ܓǂ߂i1̌JԂ̊mFANeBreBǗ͕svj
 	std::lock_guard<std::mutex> lk(m_mutex);
-	return IsHandleValid_NoLock(handle);
+	size_t resolved = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (IsHandleValid_NoLock(handles[i])) {
+			out[i] = SlotAt(handles[i].index).obj.get();
+			++resolved;
+		}
+		else {
+			out[i] = nullptr;
+		}
+	}
+	return resolved;
+}
+
+bool ObjectPool::IsHandleValid(ObjectHandle handle) const
+{
+	// allow during shutdown (reads only)
+	// bN͎炸AXbǧJԂŔ肷
+	if (!handle.IsValid()) return false;
+	if (handle.index >= SlotCount()) return false;
+	return StateMatches(SlotAt(handle.index).state.load(std::memory_order_acquire), handle);
 }
 
 size_t ObjectPool::PoolSize() const
 {
 	std::lock_guard<std::mutex> lk(m_mutex);
-	return m_slots.size();
+	return SlotCount();
 }
 
 size_t ObjectPool::ActiveCount() const
 {
+	// ^ʂ̐Xg̍viXbgŜ͑Ȃj
 	std::lock_guard<std::mutex> lk(m_mutex);
 	size_t cnt = 0;
-	for (const auto& s : m_slots) if (s.inUse && s.obj) ++cnt;
+	for (const LiveList& live : m_liveByType) cnt += live.indices.size();
 	return cnt;
 }
 
 size_t ObjectPool::FreeCount() const {
 	std::lock_guard<std::mutex> lk(m_mutex);
-	return m_freeIndices.size();
+	size_t cnt = m_emptyIndices.size();
+	for (const auto& list : m_freeByType) cnt += list.size();
+	return cnt;
+}
+
+ObjectPool::TypeCounts ObjectPool::CountsOf(uint32_t typeId) const
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	TypeCounts counts;
+	if (typeId < m_activeByType.size()) counts.active = m_activeByType[typeId];
+	if (typeId < m_freeByType.size()) counts.idle = m_freeByType[typeId].size();
+	if (typeId < m_peakByType.size()) counts.peak = m_peakByType[typeId];
+	return counts;
+}
+
+ObjectPool::TypeStats ObjectPool::StatsOf(uint32_t typeId) const
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	TypeStats stats;
+	if (typeId >= m_statsByType.size()) return stats;
+	stats = m_statsByType[typeId];
+	stats.active = m_activeByType[typeId];
+	stats.idle = m_freeByType[typeId].size();
+	stats.peak = m_peakByType[typeId];
+	return stats;
+}
+
+void ObjectPool::ResetStats()
+{
+	std::lock_guard<std::mutex> lk(m_mutex);
+	std::fill(m_statsByType.begin(), m_statsByType.end(), TypeStats());
 }
 
 void ObjectPool::DumpState() const {
 	std::lock_guard<std::mutex> lk(m_mutex);
-	DebugLogFmt("Pool: slots=%zu free=%zu\n", m_slots.size(), m_freeIndices.size());
-	for (uint32_t i = 0; i < m_slots.size(); ++i) {
-		const Slot& s = m_slots[i];
+	const uint32_t slotCount = SlotCount();
+	DebugLogFmt("Pool: slots=%u empty=%zu\n", slotCount, m_emptyIndices.size());
+	for (uint32_t t = 1; t < m_freeByType.size(); ++t) {
+		DebugLogFmt(" type[%u] active=%zu idle=%zu peak=%zu\n", t, m_activeByType[t], m_freeByType[t].size(), m_peakByType[t]);
+	}
+	for (uint32_t i = 0; i < slotCount; ++i) {
+		const Slot& s = SlotAt(i);
 		int hasObj = s.obj ? 1 : 0;
 		int inUse = s.inUse ? 1 : 0;
-		DebugLogFmt(" slot[%u] gen=%u inUse=%d hasObj=%d use_count=%d\n",
-			i, s.generation, inUse, hasObj, s.obj ? static_cast<int>(s.obj.use_count()) : 0);
+		DebugLogFmt(" slot[%u] gen=%u type=%u inUse=%d hasObj=%d use_count=%d\n",
+			i, s.generation, s.typeId, inUse, hasObj, s.obj ? static_cast<int>(s.obj.use_count()) : 0);
 	}
 }
 
@@ -188,18 +1126,135 @@ size_t ObjectPool::TotalDeleted() const {
 bool ObjectPool::IsHandleValid_NoLock(ObjectHandle handle) const
 {
 	if (!handle.IsValid()) return false;
-	if (handle.index >= m_slots.size()) return false;
-	const Slot& slot = m_slots[handle.index];
+	if (handle.index >= SlotCount()) return false;
+	const Slot& slot = SlotAt(handle.index);
 	if (!slot.inUse) return false;
 	if (slot.generation != handle.generation) return false;
+	if (handle.typeId != 0 && slot.typeId != handle.typeId) return false; // ^^O͐r̂
 	if (!slot.obj) return false;
 	return true;
 }
 
+uint32_t ObjectPool::AppendSlot_NoLock()
+{
+	const uint32_t index = m_slotCount.load(std::memory_order_relaxed);
+	const uint32_t chunk = index / SlotChunkSize;
+	ASSERT_MSG(chunk < MaxSlotChunks, "ObjectPool: slot capacity exceeded");
+
+	// `N܂ΐVmۂi`N͈ړȂj
+	// Compact Ŏ菜͈͂ɑꍇ̓`NcĂ̂ŁÂ܂܎giXbg̐͑iނ̂ŌÂnhƂ͈vȂj
+	if (!m_chunks[chunk]) {
+		m_chunks[chunk].reset(new Slot[SlotChunkSize]);
+	}
+	m_lastGrowFrame = m_frame;
+
+	// XbgmیɌJiǂݎ葤͌ acquire œǂނ̂Ŗ͌Ȃj
+	m_slotCount.store(index + 1, std::memory_order_release);
+	return index;
+}
+
+void ObjectPool::EnsureTypeTables_NoLock(uint32_t typeId)
+{
+	if (typeId >= m_freeByType.size()) {
+		m_freeByType.resize(typeId + 1);
+		m_activeByType.resize(typeId + 1, 0);
+		m_reservedByType.resize(typeId + 1, 0);
+		m_peakByType.resize(typeId + 1, 0);
+		m_liveByType.resize(typeId + 1);
+		m_statsByType.resize(typeId + 1);
+	}
+}
+
+void ObjectPool::CountAcquire_NoLock(uint32_t typeId, AcquireSource source, size_t count)
+{
+	TypeStats& stats = m_statsByType[typeId];
+	switch (source)
+	{
+	case AcquireSource::SameTypeFree:	stats.freeHits += count; break;
+	case AcquireSource::EmptySlot:		stats.emptyReuse += count; break;
+	case AcquireSource::OtherTypeFree:	stats.mismatchOverwrites += count; break;
+	case AcquireSource::NewSlot:		stats.newSlots += count; break;
+	}
+}
+
+void ObjectPool::RecordLatency_NoLock(uint32_t typeId, std::chrono::steady_clock::time_point start)
+{
+	if (start == std::chrono::steady_clock::time_point()) return; // vĂȂ
+
+	// 2 ̉imbŃoPbg߂
+	const long long nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	size_t bucket = 0;
+	for (unsigned long long n = nanos > 1 ? static_cast<unsigned long long>(nanos) : 1; n > 1; n >>= 1) ++bucket;
+	if (bucket >= TypeStats::LatencyBuckets) bucket = TypeStats::LatencyBuckets - 1;
+	++m_statsByType[typeId].latency[bucket];
+}
+
+bool ObjectPool::PopOtherTypeFree_NoLock(uint32_t& outIndex)
+{
+	// ^̎ނ͏Ȃ̂Ō^e[u𑖍iXbgŜ͑Ȃj
+	for (auto& list : m_freeByType) {
+		if (list.empty()) continue;
+		outIndex = PopFree_NoLock(list);
+		return true;
+	}
+	return false;
+}
+
+void ObjectPool::PushFree_NoLock(uint32_t index)
+{
+	Slot& slot = SlotAt(index);
+	std::vector<uint32_t>& list = slot.obj ? m_freeByType[slot.typeId] : m_emptyIndices;
+	slot.freeListPos = static_cast<uint32_t>(list.size());
+	list.push_back(index);
+}
+
+void ObjectPool::RemoveLive_NoLock(uint32_t index)
+{
+	Slot& slot = SlotAt(index);
+	const uint32_t pos = slot.livePos;
+	if (pos == NotInList || slot.typeId >= m_liveByType.size()) return;
+
+	LiveList& live = m_liveByType[slot.typeId];
+	if (pos >= live.indices.size() || live.indices[pos] != index) return; // ̃XgɓĂȂ
+
+	// ̗vf󂢂ʒuֈڂÄʒuXV
+	const uint32_t last = live.indices.back();
+	live.indices[pos] = last;
+	live.objects[pos] = live.objects.back();
+	SlotAt(last).livePos = pos;
+	live.indices.pop_back();
+	live.objects.pop_back();
+	slot.livePos = NotInList;
+}
+
+uint32_t ObjectPool::PopFree_NoLock(std::vector<uint32_t>& list)
+{
+	const uint32_t index = list.back();
+	list.pop_back();
+	SlotAt(index).freeListPos = NotInList;
+	return index;
+}
+
+void ObjectPool::RemoveFromFreeList_NoLock(std::vector<uint32_t>& list, uint32_t index)
+{
+	Slot& slot = SlotAt(index);
+	const uint32_t pos = slot.freeListPos;
+	if (pos == NotInList || pos >= list.size() || list[pos] != index) return; // ̃XgɓĂȂ
+
+	// ̗vf󂢂ʒuֈڂÄʒuXV
+	const uint32_t last = list.back();
+	list[pos] = last;
+	SlotAt(last).freeListPos = pos;
+	list.pop_back();
+	slot.freeListPos = NotInList;
+}
+
 void ObjectPool::UpdateAllObjectsScene(const std::weak_ptr<SceneBase>& scene)
 {
 	std::lock_guard<std::mutex> lk(m_mutex);
-	for (auto& s : m_slots) {
+	const uint32_t slotCount = SlotCount();
+	for (uint32_t i = 0; i < slotCount; ++i) {
+		Slot& s = SlotAt(i);
 		if (s.obj) {
 			s.obj->SetScene(scene);
 		}
@@ -4,6 +4,7 @@
 #include "GameObject.h"
 #include "Factory.h"
 #include "Assert.h"
+#include "ObjectTypeId.h"
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -16,6 +17,13 @@
 #include <sstream>
 #include <cstdarg>
 #include <atomic>
+#include <deque>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <functional>
+#include <thread>
+#include <condition_variable>
 
 // fobOOo̓wp[
 static inline void DebugLogFmt(const char* fmt, ...)
@@ -28,6 +36,59 @@ static inline void DebugLogFmt(const char* fmt, ...)
 	OutputDebugStringA(buf);
 }
 
+// ėp Reset tbNoiT  Reset(Args...) 邩j
+namespace ObjectPoolDetail
+{
+	template <typename...>
+	struct VoidT { using type = void; };
+
+	template <typename T, typename ArgsTuple, typename = void>
+	struct HasReset : std::false_type {};
+
+	template <typename T, typename... Args>
+	struct HasReset<T, std::tuple<Args...>, typename VoidT<decltype(std::declval<T&>().Reset(std::declval<Args>()...))>::type> : std::true_type {};
+}
+
+// t[LȐ|C^iObjectPool::Pin Ŏ擾j
+// shared_ptr Rs[Ȃ̂ŎQƃJEg̍XVBv[ AdvanceFrame ܂ŃIuWFNgjȂ߁A
+// 擾t[̊Ԃ͉E㏑Ăw͐Ăit[܂ŕێȂƁj
+// fobOrhł̓t[i񂾌ɎQƂƃAT[g
+template <typename T>
+class FramePin
+{
+public:
+	FramePin() = default;
+	FramePin(T* ptr, const std::atomic<uint64_t>* frameSource) : m_ptr(ptr)
+	{
+#ifndef NDEBUG
+		m_frameSource = frameSource;
+		m_frame = frameSource ? frameSource->load(std::memory_order_relaxed) : 0;
+#else
+		(void)frameSource;
+#endif
+	}
+
+	T* Get() const { CheckFrame(); return m_ptr; }
+	T* operator->() const { CheckFrame(); return m_ptr; }
+	T& operator*() const { CheckFrame(); return *m_ptr; }
+	explicit operator bool() const { return m_ptr != nullptr; }
+
+private:
+	void CheckFrame() const
+	{
+#ifndef NDEBUG
+		ASSERT_MSG(!m_ptr || !m_frameSource || m_frameSource->load(std::memory_order_relaxed) == m_frame, "FramePin used after the frame it was pinned in");
+#endif
+	}
+
+private:
+	T* m_ptr = nullptr;
+#ifndef NDEBUG
+	const std::atomic<uint64_t>* m_frameSource = nullptr; // v[̃t[ԍ
+	uint64_t m_frame = 0; // 擾̃t[ԍ
+#endif
+};
+
 class ObjectPool
 {
 private:
@@ -38,118 +99,181 @@ private:
 		~ActivityGuard() { counter.fetch_sub(1, std::memory_order_relaxed); }
 	};
 
+	// 󂫃XgEXgɓĂȂƂʒu
+	static const uint32_t NotInList = 0xFFFFFFFFu;
+
 	// Xbg
+	// ݁iAcquire/Release/CleanupIdle j m_mutex ōsA
+	// ǂݎiGet/IsHandleValidj̓bN炸 state  obj  atomic ɎQƂ
 	struct Slot
 	{
-		std::shared_ptr<GameObject> obj; // ́inullptrȂ疢ێj
-		uint32_t generation =0; // ԍ
+		std::shared_ptr<GameObject> obj; // ́inullptrȂ疢ێB݂ ExchangeObject_NoLock ōsj
+		std::atomic<GameObject*> raw{ nullptr }; // obj.get() ̎ʂiPin QƃJEgɐGꂸɓǂށj
+		std::atomic<uint64_t> state{ 0 }; // ǂݎp̌JԁiPublishState_NoLock QƁj
+		uint32_t generation =0; // ԍiObjectHandle::GenerationMask ŏzj
+		uint32_t typeId =0; // ێĂIuWFNǧ^IDi0 Ȃ疢ێj
 		bool inUse = false; // gptO
-		std::chrono::steady_clock::time_point lastUsed = std::chrono::steady_clock::now(); // ŏIgp
+		bool prewarmed = false; // Reserve ŎOXbgiCleanupIdle ̑ΏۊOj
+		uint32_t freeListPos = NotInList; // 󂫃Xgi^ʂ܂͖ێj̈ʒuiĂȂ NotInListj
+		uint32_t livePos = NotInList; // ^ʂ̐Xg̈ʒuigpłȂ NotInListj
+		uint64_t lastUsedFrame = 0; // ŏIgpt[iAdvanceFrame Őiރt[ԍBOS ̎v͓ǂ܂Ȃj
+		uint32_t sceneId = 0; // 擾ɊJĂV[A[ii0 ȂV[ɑȂBEndSceneArena ł܂Ƃ߂ĉj
+		bool pending = false; // [J[XbhŐiAcquireAsync / [BAdvanceFrame Ŋi[j
+		bool releaseOnCommit = false; //  Release ꂽii[ɉj
+	};
+
+	// ҋ@L[̃GgiꂽɐςށBXbgėpEjꂽ琢̕svŖɂȂj
+	struct IdleEntry
+	{
+		uint32_t index;											// Xbgԍ
+		uint32_t generation;									// ̐ԍ
+		uint64_t releasedFrame;									// ̃t[ԍ
+		double releasedSeconds;									// ̌oߕbiAdvanceFrame ̗݌vj
+	};
+
+	// ^ʂ̐XgigpXbgl߂ĕׂBForEachLive őj
+	struct LiveList
+	{
+		std::vector<uint32_t> indices;		// Xbgԍ
+		std::vector<GameObject*> objects;	// ́iindices ƓсBɃnhȂ߁j
+	};
+
+	// Xbg̓`NPʂŊmۂAAhXŒ肷ibNǂݎ蒆ɍĔzuȂ悤Ɂj
+	static const uint32_t SlotChunkSize = 1024;	// 1`ÑXbg
+	static const uint32_t MaxSlotChunks = 4096;	// `N̏iőXbg = 4Mj
+
+	// JԂ̃rbgzu: [32] tO / [31..24] ^ID / [23..0] ԍ
+	static const uint64_t StateLiveBit = 1ull << 32;
+
+public:
+	// [J[XbhŎs鐶֐io^ς݂̐1j
+	using CreateFn = std::function<std::shared_ptr<GameObject>()>;
+
+	// ^IDw肵1֐iRestore Ŏ̂蒼ƂɎgBłȂ nullptrj
+	using CreateByTypeFn = std::function<std::shared_ptr<GameObject>(uint32_t typeId)>;
+
+	// ^ʂ̃JEg
+	struct TypeCounts
+	{
+		size_t active =0; // gp̐
+		size_t idle =0;   // 󂫃Xgőҋ@iIuWFNgێj̐
+		size_t peak =0;   // ZbV̓gp̍őliÕvt@CɎgj
+	};
+
+	// \Z̏ŐVCX^XȂƂ̓
+	enum class CapPolicy : uint8_t
+	{
+		Fail,			// 擾ɎsiȃnhԂj
+		Block,			// ܂ő҂iblockTimeoutMs ŎsBCXbhȊO擾ꍇpj
+		RecycleOldest,	// ^ōłOɎ擾gpCX^XĎg񂷁iȅȂǁBEnd ͌Ă΂Ȃj
+	};
+
+	// v[ێCX^Xigp + ҋ@ + j̗\ZB0 ͖
+	// iAcquireAsyncE[̈˗AAcquire bNOŐĂԁĵŁAt[ɉ擾Ă𒴂Ȃ
+	struct Budget
+	{
+		size_t maxCount = 0;				// CX^X̏
+		size_t maxBytes = 0;				// sizeof ̍v̏
+		CapPolicy policy = CapPolicy::Fail;	// ɒBƂ̓
+		uint32_t blockTimeoutMs = 16;		// CapPolicy::Block ő҂ő厞
+	};
+
+	// 擾ɃXbgǂmۂieg̕ށj
+	enum class AcquireSource : uint8_t
+	{
+		SameTypeFree,	// ^̑ҋ@CX^XėpiȂj
+		EmptySlot,		// IuWFNgێ̋󂫃XbgɐVK
+		OtherTypeFree,	// ̌^̑ҋ@CX^X㏑ĐVK
+		NewSlot,		// XbgǉĐVK
+	};
+
+	// ^ʂ̃egiZbV̗݌vBClearAll łȂj
+	struct TypeStats
+	{
+		static const size_t LatencyBuckets = 24; // oPbg i  [2^i, 2^(i+1)) imbiŌ̃oPbg͏Ȃj
+
+		uint64_t freeHits = 0;				// AcquireSource::SameTypeFree ̉
+		uint64_t emptyReuse = 0;			// AcquireSource::EmptySlot ̉
+		uint64_t mismatchOverwrites = 0;	// AcquireSource::OtherTypeFree ̉񐔁i㏑̌^Őj
+		uint64_t newSlots = 0;				// AcquireSource::NewSlot ̉
+		uint64_t prebuilt = 0;				// ReserveE[ŎO
+		uint64_t releases = 0;				// 
+		uint64_t evictions = 0;				// CleanupIdleEEndSceneArena Ŕjҋ@CX^X̐
+		size_t active = 0;					// ݂̎gp̐i擾_̒lj
+		size_t idle = 0;					// ݂̑ҋ@̐i擾_̒lj
+		size_t peak = 0;					// gp̍ől
+		uint64_t latency[LatencyBuckets] = {}; // Acquire/AcquireN/AcquireAsync 1̏vԂ̃qXgOiSetTelemetryEnabled(true) ̊Ԃj
 	};
 
 public:
 	ObjectPool() = default;
-	~ObjectPool() = default;
+	~ObjectPool() { StopWorker(); }
 
 	// Acquire: v[擾iėp or VKj
 	template <typename T, typename... Args>
-	ObjectHandle Acquire(Args&&... args)
+	TypedHandle<T> Acquire(Args&&... args)
 	{
 		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
 
 		// Vbg_E͎擾
 		if (m_shuttingDown.load(std::memory_order_acquire)) {
 			DebugLogFmt("[ObjectPool] Acquire refused: shutting down\n");
-			return ObjectHandle(); // invalid
+			return TypedHandle<T>(); // invalid
 		}
 		ActivityGuard ag(m_activeOps);
+		const auto acquireStart = LatencyStart();
 
-		using Clock = std::chrono::steady_clock;
-		auto now = Clock::now();
+		const uint32_t typeId = ObjectTypeId::Of<T>(); // vꂽ^ID
 
 		// bN擾
 		std::unique_lock<std::mutex> lk(m_mutex);
+		EnsureTypeTables_NoLock(typeId);
+
+		// VƗ\Z𒴂ꍇ͋󂫂iRecycleOldest ŋ󂢂CX^X͉̓^̋󂫃Xgėpj
+		if (m_freeByType[typeId].empty() && !MakeRoom_NoLock(lk, typeId, 0)) {
+			DebugLogFmt("[ObjectPool] Acquire refused: type=%s over budget\n", typeid(T).name());
+			return TypedHandle<T>();
+		}
 
 		uint32_t idx =0;
 
-		//܂͋󂫃XgCfbNX擾
-		if (!m_freeIndices.empty())
+		// ܂͓^̋󂫃Xg擾iO(1)ARTTI ɂ^͕svj
+		std::vector<uint32_t>& sameTypeFree = m_freeByType[typeId];
+		if (!sameTypeFree.empty())
 		{
-			auto it = std::find_if(m_freeIndices.begin(), m_freeIndices.end(), [&](uint32_t i) {
-				if (i >= m_slots.size()) return false;
-				auto& s = m_slots[i];
-				if (!s.obj) return false;
-				return static_cast<bool>(std::dynamic_pointer_cast<T>(s.obj));
-				});
-
-			if (it != m_freeIndices.end()) {
-				idx = *it;
-				m_freeIndices.erase(it);
-				DebugLogFmt("[ObjectPool] Reserve idx=%u (reusing same-type free). freeCount=%zu\n", idx, m_freeIndices.size());
-			}
-			else {
-				// fallback: take last free index
-				idx = m_freeIndices.back();
-				m_freeIndices.pop_back();
-				DebugLogFmt("[ObjectPool] Reserve idx=%u (popped). freeCount=%zu\n", idx, m_freeIndices.size());
-			}
+			idx = PopFree_NoLock(sameTypeFree);
+			DebugLogFmt("[ObjectPool] Reuse slot idx=%u gen=%u type=%s (same-type free). typeFree=%zu\n", idx, SlotAt(idx).generation, typeid(T).name(), sameTypeFree.size());
+			const TypedHandle<T> reused = ReuseSlot_NoLock<T>(idx, std::forward<Args>(args)...);
+			CountAcquire_NoLock(typeId, AcquireSource::SameTypeFree, 1);
+			RecordLatency_NoLock(typeId, acquireStart);
+			return reused;
+		}
+
+		// ^ꍇ: IuWFNgێ̋  ̌^̋󂫁i㏑j  VKXbg ̏Ŋm
+		AcquireSource source = AcquireSource::NewSlot;
+		if (!m_emptyIndices.empty())
+		{
+			idx = PopFree_NoLock(m_emptyIndices);
+			source = AcquireSource::EmptySlot;
+			DebugLogFmt("[ObjectPool] Reserve idx=%u (empty slot). emptyCount=%zu\n", idx, m_emptyIndices.size());
+		}
+		else if (PopOtherTypeFree_NoLock(idx))
+		{
+			source = AcquireSource::OtherTypeFree;
+			DebugLogFmt("[ObjectPool] Slot idx=%u has object of type=%s but requested type=%s\n", idx, typeid(*SlotAt(idx).obj).name(), typeid(T).name());
 		}
 		else
 		{
-			// 󂫃Xgꍇ̓XLčėp\ȃIuWFNgT
-			bool reused = false;
-			for (uint32_t i =0; i < m_slots.size(); ++i) {
-				Slot& s = m_slots[i];
-				if (!s.inUse && s.obj && s.obj.use_count() ==1) {
-					auto existing = std::dynamic_pointer_cast<T>(s.obj);
-					if (existing) {
-						idx = i;
-						reused = true;
-						DebugLogFmt("[ObjectPool] Reserve idx=%u (scan reuse). slots=%zu\n", idx, m_slots.size());
-						// ėp\
-						s.inUse = true;
-						s.lastUsed = now;
-						// ėp: ďKvȂ̂ InitObject Ă
-						try { s.obj->InitObject(); }
-						catch (...) { DebugLogFmt("[ObjectPool] Exception during InitObject on scanned reuse idx=%u\n", idx); }
-						return ObjectHandle(idx, s.generation);
-					}
-				}
-			}
-
-			if (!reused) {
-				idx = static_cast<uint32_t>(m_slots.size());
-				m_slots.emplace_back();
-				DebugLogFmt("[ObjectPool] Reserve idx=%u (new slot). slots=%zu\n", idx, m_slots.size());
-			}
+			idx = AppendSlot_NoLock();
+			DebugLogFmt("[ObjectPool] Reserve idx=%u (new slot). slots=%u\n", idx, SlotCount());
 		}
 
 		// ̃XbhXbgėpłȂ悤ɗ\ς݃tO𗧂Ă
-		m_slots[idx].inUse = true;
-		m_slots[idx].lastUsed = now;
-		uint32_t curGen = m_slots[idx].generation;
-
-		//IuWFNg^Ȃėp
-		if (m_slots[idx].obj)
-		{
-			auto existing = std::dynamic_pointer_cast<T>(m_slots[idx].obj);
-			if (existing)
-			{
-				DebugLogFmt("[ObjectPool] Reuse slot idx=%u gen=%u type=%s\n", idx, curGen, typeid(*m_slots[idx].obj).name());
-				// ėp: ďKvȂ̂ InitObject Ă
-				try {
-					m_slots[idx].obj->InitObject();
-				}
-				catch (...) {
-					DebugLogFmt("[ObjectPool] Exception during InitObject on reuse idx=%u\n", idx);
-				}
-				m_slots[idx].lastUsed = Clock::now();
-				return ObjectHandle(idx, curGen);
-			}
-			else {
-				DebugLogFmt("[ObjectPool] Slot idx=%u has object of type=%s but requested type=%s\n", idx, typeid(*m_slots[idx].obj).name(), typeid(T).name());
-			}
-		}
+		// iJԂ͐܂ōXVȂ̂ŁAǂݎ葤͖̂܂܁j
+		SlotAt(idx).inUse = true;
+		SlotAt(idx).lastUsedFrame = m_frame;
+		SlotAt(idx).sceneId = 0; // i[Ɍ݂̃V[ݒ肷
+		++m_reservedByType[typeId]; // ĂԂ\Zɐ
 
 		// bNOĐVIuWFNg𐶐
 		lk.unlock();
@@ -159,76 +283,454 @@ public:
 
 		// ēxbN擾
 		std::lock_guard<std::mutex> guard(m_mutex);
+		--m_reservedByType[typeId]; // ȍ~͎gpƂĐ
 
 		// XbgĂ\̂ōĊmF
-		if (idx >= m_slots.size())
+		if (idx >= SlotCount())
 		{
 			// VXbgǉ
-			idx = static_cast<uint32_t>(m_slots.size());
-			m_slots.emplace_back();
-			m_slots[idx].inUse = true;
-			m_slots[idx].lastUsed = now;
+			idx = AppendSlot_NoLock();
+			SlotAt(idx).inUse = true;
+			SlotAt(idx).lastUsedFrame = m_frame;
 		}
 
+		Slot& slot = SlotAt(idx);
+
 		// VKȂ̂ŐY݌v𑝂₷
 		++m_totalCreated;
 
 		//ɃXbgɃIuWFNgcĂāÃIuWFNgv[݂̂̏Liuse_count==1jȂ
 		// VIuWFNgŏ㏑邱ƂŎۂɉs邽߁A폜JEg𑝂₷
-		if (m_slots[idx].obj) {
-			if (m_slots[idx].obj.use_count() ==1) {
+		if (slot.obj) {
+			if (slot.obj.use_count() ==1) {
 				++m_totalDeleted;
 			}
 		}
 
-		m_slots[idx].obj = std::static_pointer_cast<GameObject>(createdObj);
-		m_slots[idx].lastUsed = Clock::now();
+		// ㏑ŎIuWFNg͎ AdvanceFrame ܂ŔjȂiPin ̐|C^邽߁j
+		Retire_NoLock(ExchangeObject_NoLock(slot, std::static_pointer_cast<GameObject>(createdObj)));
+		slot.typeId = typeId;
+		slot.prewarmed = false; // ʂ̌^ŏ㏑ꍇ͎O̕یO
+		slot.sceneId = m_sceneArena;
+		slot.lastUsedFrame = m_frame;
+		NoteAcquired_NoLock(idx);
 		// tbNĂԁiv[֊i[ɌĂԁj
-		if (m_slots[idx].obj) {
-			m_slots[idx].obj->InitObject();
+		if (slot.obj) {
+			slot.obj->InitObject();
 		}
-		DebugLogFmt("[ObjectPool] Create stored idx=%u gen=%u slots=%zu free=%zu totalCreated=%zu totalDeleted=%zu\n", idx, m_slots[idx].generation, m_slots.size(), m_freeIndices.size(), m_totalCreated, m_totalDeleted);
+		PublishState_NoLock(slot);
+		CountAcquire_NoLock(typeId, source, 1);
+		RecordLatency_NoLock(typeId, acquireStart);
+		DebugLogFmt("[ObjectPool] Create stored idx=%u gen=%u type=%s slots=%u totalCreated=%zu totalDeleted=%zu\n", idx, slot.generation, typeid(T).name(), SlotCount(), m_totalCreated, m_totalDeleted);
 
-		return ObjectHandle(idx, m_slots[idx].generation);
+		return TypedHandle<T>(idx, slot.generation);
 	}
 
-	// Get: nh shared_ptr<T> 擾iȂ nullptrj
-	template <typename T>
-	std::shared_ptr<T> Get(ObjectHandle handle)
+	// AcquireN: count ܂Ƃ߂Ď擾 out[0..count) Ƀnhށi߂l͎擾łj
+	// bN͗\񎞂Ɗi[2񂾂A̓bNOł܂Ƃ߂čsBargs ͊eɓln
+	template <typename T, typename... Args>
+	size_t AcquireN(size_t count, ObjectHandle* out, const Args&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+		if (count == 0 || out == nullptr) return 0;
+
+		// Vbg_E͎擾
+		if (m_shuttingDown.load(std::memory_order_acquire)) {
+			DebugLogFmt("[ObjectPool] AcquireN refused: shutting down\n");
+			return 0;
+		}
+		ActivityGuard ag(m_activeOps);
+		const auto acquireStart = LatencyStart();
+
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+
+		size_t written = 0;				// out ֏񂾐
+		std::vector<uint32_t> reserved;	// VKKvȃXbg
+
+		{
+			std::unique_lock<std::mutex> lk(m_mutex);
+			EnsureTypeTables_NoLock(typeId);
+
+			// ^̋󂫃Xgėpł镪Ɏ
+			std::vector<uint32_t>& sameTypeFree = m_freeByType[typeId];
+			while (written < count && !sameTypeFree.empty())
+			{
+				out[written++] = ReuseSlot_NoLock<T>(PopFree_NoLock(sameTypeFree), args...);
+			}
+			CountAcquire_NoLock(typeId, AcquireSource::SameTypeFree, written);
+
+			// c Acquire Ɠiێ̋  ̌^̋  VKXbgjł܂Ƃ߂ė\񂷂
+			reserved.reserve(count - written);
+			while (written + reserved.size() < count)
+			{
+				// \Z𒴂镪͎擾ȂiRecycleOldest ŋ󂢂CX^X͂̏ōėpB\ς݂͗̕\ZɐĂj
+				if (!MakeRoom_NoLock(lk, typeId, 0)) break;
+				if (!m_freeByType[typeId].empty()) {
+					out[written++] = ReuseSlot_NoLock<T>(PopFree_NoLock(m_freeByType[typeId]), args...);
+					CountAcquire_NoLock(typeId, AcquireSource::SameTypeFree, 1);
+					continue;
+				}
+
+				uint32_t idx = 0;
+				AcquireSource source = AcquireSource::NewSlot;
+				if (!m_emptyIndices.empty()) {
+					idx = PopFree_NoLock(m_emptyIndices);
+					source = AcquireSource::EmptySlot;
+				}
+				else if (PopOtherTypeFree_NoLock(idx)) {
+					source = AcquireSource::OtherTypeFree;
+				}
+				else {
+					idx = AppendSlot_NoLock();
+				}
+				CountAcquire_NoLock(typeId, source, 1);
+				SlotAt(idx).inUse = true;
+				SlotAt(idx).lastUsedFrame = m_frame;
+				SlotAt(idx).sceneId = 0;
+				++m_reservedByType[typeId];
+				reserved.push_back(idx);
+			}
+
+			// Sėpōς񂾂炱ŏIiԂ1̌ĂяoPʂŋL^j
+			if (reserved.empty()) RecordLatency_NoLock(typeId, acquireStart);
+		}
+
+		DebugLogFmt("[ObjectPool] AcquireN type=%s count=%zu reused=%zu reserved=%zu\n", typeid(T).name(), count, written, reserved.size());
+		if (reserved.empty()) return written;
+
+		// bNOł܂Ƃ߂Đ
+		std::vector<std::shared_ptr<T>> created;
+		created.reserve(reserved.size());
+		for (size_t i = 0; i < reserved.size(); ++i) {
+			created.push_back(Factory::GetInstance().CreateObject<T>(args...));
+		}
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_reservedByType[typeId] -= reserved.size(); // ȍ~͎gpƂĐ
+		for (size_t i = 0; i < reserved.size(); ++i)
+		{
+			const uint32_t idx = reserved[i];
+			Slot& slot = SlotAt(idx);
+
+			++m_totalCreated;
+			if (slot.obj && slot.obj.use_count() == 1) {
+				++m_totalDeleted;
+			}
+
+			Retire_NoLock(ExchangeObject_NoLock(slot, std::static_pointer_cast<GameObject>(created[i])));
+			slot.typeId = typeId;
+			slot.prewarmed = false;
+			slot.sceneId = m_sceneArena;
+			slot.lastUsedFrame = m_frame;
+			NoteAcquired_NoLock(idx);
+			if (slot.obj) {
+				slot.obj->InitObject();
+			}
+			PublishState_NoLock(slot);
+			out[written++] = TypedHandle<T>(idx, slot.generation);
+		}
+		RecordLatency_NoLock(typeId, acquireStart);
+		return written;
+	}
+
+	// AcquireAsync: [J[XbhōsA҂̃nhɕԂ
+	// ^̑ҋ@CX^X΂̏ōėpiLjBΎ AdvanceFrame ŗLɂȂ
+	// ܂ł Get/Pin/IsHandleValid ͖ɌiIsPending ŋʂłjB Release Ă悢
+	// args ̓[J[XbhփRs[ēn̂ŁARs[łăXbh܂Ŏglɂ邱
+	// T ̃RXgN^ioq܂ށj̓[J[Xbhœ̂ŁADxLib ̊֐Ă΂Ȃ
+	// DxLib g InitObject / Reset ɒuiǂ AdvanceFrameE擾ɃCXbhŌĂ΂j
+	template <typename T, typename... Args>
+	TypedHandle<T> AcquireAsync(const Args&... args)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+
+		// Vbg_E͎擾
+		if (m_shuttingDown.load(std::memory_order_acquire)) {
+			DebugLogFmt("[ObjectPool] AcquireAsync refused: shutting down\n");
+			return TypedHandle<T>();
+		}
+		ActivityGuard ag(m_activeOps);
+		const auto acquireStart = LatencyStart();
+
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+		std::vector<BuildJob> jobs(1);
+		BuildJob& job = jobs[0];
+		{
+			std::unique_lock<std::mutex> lk(m_mutex);
+			EnsureTypeTables_NoLock(typeId);
+
+			// \Z̊mF Acquire Ɠi̕\Zɐj
+			if (m_freeByType[typeId].empty() && !MakeRoom_NoLock(lk, typeId, 0)) {
+				DebugLogFmt("[ObjectPool] AcquireAsync refused: type=%s over budget\n", typeid(T).name());
+				return TypedHandle<T>();
+			}
+
+			std::vector<uint32_t>& sameTypeFree = m_freeByType[typeId];
+			if (!sameTypeFree.empty()) {
+				const TypedHandle<T> reused = ReuseSlot_NoLock<T>(PopFree_NoLock(sameTypeFree), args...);
+				CountAcquire_NoLock(typeId, AcquireSource::SameTypeFree, 1);
+				RecordLatency_NoLock(typeId, acquireStart);
+				return reused;
+			}
+
+			CountAcquire_NoLock(typeId, m_emptyIndices.empty() ? AcquireSource::NewSlot : AcquireSource::EmptySlot, 1);
+			job.index = ReservePending_NoLock(typeId);
+			job.generation = SlotAt(job.index).generation;
+			job.typeId = typeId;
+			job.refill = false;
+			RecordLatency_NoLock(typeId, acquireStart); // ̓[J[XbhōŝŁAnhԂ܂ł̎
+		}
+		job.create = [args...]() -> std::shared_ptr<GameObject> { return Factory::GetInstance().CreateObject<T>(args...); };
+
+		const TypedHandle<T> handle(job.index, job.generation);
+		DebugLogFmt("[ObjectPool] AcquireAsync idx=%u gen=%u type=%s (pending)\n", job.index, job.generation, typeid(T).name());
+		PushJobs(jobs);
+		return handle;
+	}
+
+	// [ݒ: ^̑ҋ@CX^Xi܂ށj lowWater Atarget ɂȂ܂Ń[J[XbhŐ
+	// Ɗi[ AdvanceFrame ōsB[CX^X Reserve Ɠ CleanupIdle ̑ΏۊOBlowWater  0 Ȃ[Ȃ
+	// createi^̃RXgN^j̓[J[Xbhœ̂ŁAAcquireAsync Ɠ DxLib ̊֐Ă΂Ȃ
+	void SetRefill(uint32_t typeId, size_t lowWater, size_t target, CreateFn create);
+
+	// ҂̃nhiAcquireAsync ̒ォ玟 AdvanceFrame ܂ truej
+	bool IsPending(ObjectHandle handle) const;
+
+	// Reserve: ^ T ̑ҋ@CX^X count ɂȂ܂ŎOċ󂫃Xgɐςށi߂l͐VKj
+	// OXbg CleanupIdle ŉȂBɑҋ@Xbg킹 count ܂łیΏۂɂ
+	template <typename T, typename... Args>
+	size_t Reserve(size_t count, const Args&... args)
 	{
-		// Vbg_E͎QƂԂȂ
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+
+		// Vbg_E͋
 		if (m_shuttingDown.load(std::memory_order_acquire)) {
-			return nullptr;
+			DebugLogFmt("[ObjectPool] Reserve refused: shutting down\n");
+			return 0;
+		}
+		ActivityGuard ag(m_activeOps);
+
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+		std::vector<uint32_t> reserved; // VKXbg
+
+		{
+			std::lock_guard<std::mutex> lk(m_mutex);
+			EnsureTypeTables_NoLock(typeId);
+
+			// ɑҋ@̃CX^X́Aیς݂̂̂ƍ킹 count ܂ŕیΏۂɂi𒴂镪͕̈ςȂj
+			const std::vector<uint32_t>& sameTypeFree = m_freeByType[typeId];
+			size_t protectedCount = 0;
+			for (uint32_t idx : sameTypeFree) {
+				if (SlotAt(idx).prewarmed) ++protectedCount;
+			}
+			for (size_t i = 0; i < sameTypeFree.size() && protectedCount < count; ++i) {
+				Slot& slot = SlotAt(sameTypeFree[i]);
+				if (slot.prewarmed) continue;
+				slot.prewarmed = true;
+				++protectedCount;
+			}
+			if (sameTypeFree.size() >= count) return 0;
+
+			// ێ̋  VKXbg ̏Ŋmہǐ^̑ҋ@CX^X͏㏑ȂB\Z𒴂镪͍Ȃj
+			const size_t need = count - sameTypeFree.size();
+			reserved.reserve(need);
+			while (reserved.size() < need && CheckBudget_NoLock(typeId, 0) == BudgetCheck::Fits)
+			{
+				uint32_t idx = 0;
+				if (!m_emptyIndices.empty()) {
+					idx = PopFree_NoLock(m_emptyIndices);
+				}
+				else {
+					idx = AppendSlot_NoLock();
+				}
+				SlotAt(idx).inUse = true; // ͑Ȃ悤ɗ\iJԂ͖̂܂܁j
+				++m_reservedByType[typeId]; // ĂԂ\Zɐ
+				reserved.push_back(idx);
+			}
+		}
+
+		// bNOł܂Ƃ߂Đ
+		std::vector<std::shared_ptr<T>> created;
+		created.reserve(reserved.size());
+		for (size_t i = 0; i < reserved.size(); ++i) {
+			created.push_back(Factory::GetInstance().CreateObject<T>(args...));
+		}
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_reservedByType[typeId] -= reserved.size(); // ȍ~͑ҋ@ƂĐ
+		for (size_t i = 0; i < reserved.size(); ++i)
+		{
+			const uint32_t idx = reserved[i];
+			Slot& slot = SlotAt(idx);
+
+			++m_totalCreated;
+			Retire_NoLock(ExchangeObject_NoLock(slot, std::static_pointer_cast<GameObject>(created[i])));
+			slot.typeId = typeId;
+			slot.inUse = false; // ҋ@ԂŊi[iInitObject ͎擾ɌĂ΂j
+			slot.prewarmed = true;
+			slot.sceneId = 0; // O̓V[ɑȂ
+			slot.lastUsedFrame = m_frame;
+			PublishState_NoLock(slot);
+			PushFree_NoLock(idx);
 		}
-		ActivityGuard ag(m_activeOps); // ANeBuK[h
+		m_statsByType[typeId].prebuilt += reserved.size();
+		DebugLogFmt("[ObjectPool] Reserve type=%s created=%zu idle=%zu\n", typeid(T).name(), reserved.size(), m_freeByType[typeId].size());
+		return reserved.size();
+	}
 
+	// Get: nh shared_ptr<T> 擾iȂ nullptrj
+	// bNȂǂݎoHiEgpԂ̓XbǧJԂŔj
+	template <typename T>
+	std::shared_ptr<T> Get(ObjectHandle handle) const
+	{
 		// ^`FbN
 		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
 
-		std::lock_guard<std::mutex> lk(m_mutex);
+		uint32_t typeId =0;
+		std::shared_ptr<GameObject> obj = LoadLive(handle, typeId);
+		if (!obj) return nullptr; // nh
+
+		// ^IDSvȂ RTTI sviNXwȂǂ͏]ʂ dynamic_pointer_castj
+		if (typeId == ObjectTypeId::Of<T>()) {
+			return std::static_pointer_cast<T>(obj);
+		}
+		return std::dynamic_pointer_cast<T>(obj);
+	}
+
+	// Get typed: ^tnh shared_ptr<T> 擾i^^O͗L`FbNŏƍς݂Ȃ̂ static_pointer_castj
+	template <typename T>
+	std::shared_ptr<T> Get(TypedHandle<T> handle) const
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+
+		uint32_t typeId =0;
+		return std::static_pointer_cast<T>(LoadLive(handle, typeId)); // ^^OsvȂ nullptr
+	}
+
+	// Get : nh shared_ptr<GameObject> 擾iȂ nullptrAbNj
+	std::shared_ptr<GameObject> Get(ObjectHandle handle) const;
+
+	// Pin: nh猻݂̃t[̊ԂL T* 擾iȂAbNEQƃJEg얳j
+	template <typename T>
+	FramePin<T> Pin(ObjectHandle handle) const
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
 
-		if (!IsHandleValid_NoLock(handle)) return nullptr; // nh
+		uint32_t typeId =0;
+		GameObject* obj = LoadLiveRaw(handle, typeId);
+		if (!obj) return FramePin<T>();
+		if (typeId == ObjectTypeId::Of<T>()) {
+			return FramePin<T>(static_cast<T*>(obj), &m_frame);
+		}
+		return FramePin<T>(dynamic_cast<T*>(obj), &m_frame);
+	}
+
+	// Pin typed: ^tnhŁi^^O͗L`FbNŏƍς݁j
+	template <typename T>
+	FramePin<T> Pin(TypedHandle<T> handle) const
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
 
-		Slot& slot = m_slots[handle.index];
-		// ANZXugpvƂ݂Ȃ lastUsed XViZQƂ̃ANZXL^j
-		slot.lastUsed = std::chrono::steady_clock::now();
-		return std::dynamic_pointer_cast<T>(slot.obj);
+		uint32_t typeId =0;
+		return FramePin<T>(static_cast<T*>(LoadLiveRaw(handle, typeId)), &m_frame);
 	}
 
-	// Get : nh shared_ptr<GameObject> 擾iȂ nullptrj
-	std::shared_ptr<GameObject> Get(ObjectHandle handle);
+	// ResolveN: count ̃nh1̃bNł܂Ƃ߂Đ|C^ɉiȂ̂ out  nullptrB߂l͗LȐj
+	// |C^ Pin Ɠ݂̃t[̊ԂLBResolveStamp ςĂȂ΁ǍɖɂȂ͖̂
+	size_t ResolveN(const ObjectHandle* handles, size_t count, GameObject** out) const;
+
+	// gp̃nhɂȂ邽тɐiޒliEEndSceneArenaEClearAllERestorej
+	// ResolveN ̌ʂg񂷂ƂɁAɉ̂ɎgibNj
+	uint64_t ResolveStamp() const { return m_invalidations.load(std::memory_order_acquire); }
+
+	// Pin : nh FramePin<GameObject> 擾
+	FramePin<GameObject> Pin(ObjectHandle handle) const
+	{
+		uint32_t typeId =0;
+		return FramePin<GameObject>(LoadLiveRaw(handle, typeId), &m_frame);
+	}
 
 	// Release: nhɑΉIuWFNgv[ɖ߂iL slot.obj Ɏcj
 	bool Release(ObjectHandle handle);
 
+	// ReleaseN: ̃nh܂Ƃ߂ăv[ɖ߂ibN1A߂l͉łj
+	size_t ReleaseN(const ObjectHandle* handles, size_t count);
+
 	// ClearAll: SXbgNAiIpj
 	void ClearAll();
 
-	// N[Abv: wbȏACh̃Xbg
+	// N[Abv: wbȏACh̃XbgiReserve ŎOXbg͏j
 	size_t CleanupIdle(double maxIdleSeconds);
 
-	// L`FbNiOĂяopj
-	bool IsHandleValid(ObjectHandle handle);
+	// N[Abv: 1̌ĂяoŒׂҋ@XbgƎԁi}CNbA0 ȉȂ疳j𐧌
+	// ҋ@L[̐擪iłÂj猩Ă̂ŁAč͎Ăяoő珈
+	size_t CleanupIdleStep(double maxIdleSeconds, size_t maxSlotsPerCall, double maxMicros);
+
+	// N[Abvit[wŁj:  maxIdleFrames t[ȏoXbg
+	size_t CleanupIdleStepFrames(uint64_t maxIdleFrames, size_t maxSlotsPerCall, double maxMicros);
+
+	// t[i߂i1t[1ĂԁBdeltaSeconds  Time ̃f^^Cj
+	// Xbg̎gp͂̃t[ԍƗ݌vbŋL^A擾EQƂ̌oHł OS ̎vǂ܂Ȃ
+	// iO͎擾Ԃ̌vLɂƂƁACapPolicy::Block ̗\Ző҂Ƃj
+	// Õt[ŏ㏑EIuWFNg͂ł܂Ƃ߂Ĕji܂ł Pin ̐|C^Lj
+	// [J[XbhŐIIuWFNgŊi[A[KvȌ^̐˗
+	void AdvanceFrame(double deltaSeconds);
+
+	// ݂̃t[ԍ
+	uint64_t CurrentFrame() const;
+
+	// ^Ƃ̗\Zݒ肷igp + ҋ@̃CX^XEoCgB͖j
+	// Ȏ擾 policy ɏ]BReserve ƕ[͗\Z𒴂镪Ȃ
+	// ̂̓CX^X sizeof Ȃ̂ŁAA[i[hł̓vZX̃̓`NPʂłȂ
+	template <typename T>
+	void SetTypeBudget(const Budget& budget) { SetTypeBudget(ObjectTypeId::Of<T>(), budget); }
+
+	// ^IDw
+	void SetTypeBudget(uint32_t typeId, const Budget& budget);
+
+	// SĂ̌^킹\Zݒ肷iꍇ́A܂łOɉꂽҋ@CX^Xjj
+	void SetGlobalBudget(const Budget& budget);
+
+	// v[ێĂCX^X sizeof ̍vigp + ҋ@ + j
+	size_t HeldBytes() const;
+
+	// Compact: ɕ񂾃IuWFNgێ̋󂫃Xbg菜i߂l͎菜j
+	// Xbg͈ړȂ̂ŁAgpEҋ@ẼXbg낾ΏہBminSlots 菭Ȃ͂Ȃ
+	// 炷̂͌JXbgƋ󂫃XgŁA`Ñ͉Ȃiő厞̂܂܎cAƂɎg񂷁j
+	// bN̓ǂݎ葤͌Âǂ񂾂܂܎菜XbgɐG邱ƂAImi
+	// 菜Xbgwnh͔͈͊OŖɂȂAXbg̐オ̂܂ܑ̂ňvȂ
+	// IuWFNg̃ CleanupIdleE\Zł̔jŕԂiA[i[hł̓A[ĩ`NۂƋ󂢂Ƃj
+	// ŒZȂ̂͑SXbg񂷏iClearAllEEndSceneArena Ȃǁj
+	size_t Compact(uint32_t minSlots = 0);
+
+	// ̋lߒ: enabled Ȃ EndSceneArena ̌ƁAXbg quietFrames t[ĂȂ AdvanceFrame  Compact 
+	void SetAutoCompact(bool enabled, uint64_t quietFrames);
+
+	// V[A[iJiȍ~Ɏ擾IuWFNg͂̃A[iɑB߂l̓A[iIDj
+	uint32_t BeginSceneArena();
+
+	// V[A[i: IuWFNg1̃bNł܂Ƃ߂ĉEji߂l͔jj
+	// gp̂܂܎cĂ̂iEnd ͌Ă΂ȂjBReserve ŎOXbg͔jҋ@ɖ߂
+	// ̂̃fXgN^͎ AdvanceFrame ł܂Ƃ߂đ
+	size_t EndSceneArena(uint32_t sceneId);
+
+	// Snapshot: gp̑SXbg buffer ̖ɃoCiŏoi߂l͏oIuWFNgj
+	// 1ƂɃnhiToUint64jETransformiʒuE]EgkjEGameObject::Serialize ̏o͂
+	// ^ID̓vZXƂɍ̔Ԃ̂ŁAvZX Restore ł̂ݎgi^ŏƍAႦΎsj
+	size_t Snapshot(std::vector<uint8_t>& buffer) const;
+
+	// Restore: Snapshot ̓eɃXbg\߂iXibvVbg̃nĥ܂ܗLɂȂj
+	// XibvVbgɖgpIuWFNg͉AXbgɓ^̎̂΂̂܂܎g
+	// ̂E^ႤXbg create ō蒼 InitObject ĂԁBŌɊeIuWFNg Deserialize Ă
+	// V[̓XibvVbgɊ܂܂Ȃ̂ŁASIuWFNg̏V[ scene ɂi蒼̂ InitObject ̑Oɐݒ肷j
+	// Xbgԍ̃R[h2Ef[^ĂXibvVbg͋ۂ
+	// ̓XibvVbg̒lɖ߂̂ŁAXibvVbgɎnhȂƁiXbgg񂳂ƍĂїLɂȂ肤j
+	// CXbhĂԂƁi߂l͑S̕ɐBɎsꍇ͉ύXȂj
+	// slotsRewritten ɂ́Asꍇ܂߂ăXbg\ԂiĂяoŎnḧꗗ蒼̔fɎgj
+	bool Restore(const uint8_t* data, size_t size, const CreateByTypeFn& create, const std::weak_ptr<SceneBase>& scene, bool* slotsRewritten = nullptr);
+
+	// L`FbNiOĂяopAbNj
+	bool IsHandleValid(ObjectHandle handle) const;
 
 	// v[Ŝ̃XbgԂ
 	size_t PoolSize() const;
@@ -239,6 +741,64 @@ public:
 	// 󂫃XbgԂ
 	size_t FreeCount() const;
 
+	// ForEachLive: ^ T ̎gpIuWFNgׂĂ fn(T&) ĂԁinhEshared_ptr ̃Rs[Ȃj
+	// CXbhpi擾ECXbhōsĂOŃbNȂj
+	// 瑖̂ fn ł̐͑ΏۊOɂȂAfn ŎgĂc͔΂Ȃ
+	// ĩIuWFNgꍇ ReleaseDeferred gj
+	template <typename T, typename F>
+	void ForEachLive(F&& fn)
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+		if (typeId >= m_liveByType.size()) return;
+
+		// fn ŏ߂Ďg^𐶐ƌ^ʂ̕\Lтč蒼̂ŁAQƂ͎ɖ
+		for (size_t i = m_liveByType[typeId].objects.size(); i > 0; --i)
+		{
+			const std::vector<GameObject*>& objects = m_liveByType[typeId].objects;
+			if (i > objects.size()) continue; // fn ŕꂽꍇ
+			fn(static_cast<T&>(*objects[i - 1]));
+		}
+	}
+
+	// ^ T ̎gpIuWFNg
+	template <typename T>
+	size_t LiveCount() const
+	{
+		const uint32_t typeId = ObjectTypeId::Of<T>();
+		std::lock_guard<std::mutex> lk(m_mutex);
+		return typeId < m_liveByType.size() ? m_liveByType[typeId].indices.size() : 0;
+	}
+
+	// ^ʂ̃JEgԂ
+	template <typename T>
+	TypeCounts CountsOf() const
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+		return CountsOf(ObjectTypeId::Of<T>());
+	}
+
+	// ^IDw
+	TypeCounts CountsOf(uint32_t typeId) const;
+
+	// ^ʂ̃egԂi擾oH̓EjE擾Ԃ̃qXgOȂǁj
+	template <typename T>
+	TypeStats StatsOf() const
+	{
+		static_assert(std::is_base_of<GameObject, T>::value, "T must derive from GameObject");
+		return StatsOf(ObjectTypeId::Of<T>());
+	}
+
+	// ^IDwŁixgĂȂ^͑S 0j
+	TypeStats StatsOf(uint32_t typeId) const;
+
+	// eg̗݌v 0 ɖ߂igp̍ől̓vt@CɎĝŎcj
+	void ResetStats();
+
+	// 擾Ԃ̃qXgOv邩i falseBv͎擾1ɂ OS ̎v2ǂށj
+	// 擾oH̓Ȃǂ̉񐔂͐ݒɊւ炸ɐ
+	void SetTelemetryEnabled(bool enabled) { m_latencyEnabled.store(enabled, std::memory_order_relaxed); }
+
 	// ݂̃XbgԂOóifobOpj
 	void DumpState() const;
 
@@ -255,14 +815,272 @@ private:
 	// bNł̗L`FbN
 	bool IsHandleValid_NoLock(ObjectHandle handle) const;
 
+	// ACh臒lit[b̂ǂ炩Ŕ肷j
+	struct IdleLimit
+	{
+		bool byFrames = false;	// true Ȃt[Ŕ
+		uint64_t frames = 0;	// 臒lit[j
+		double seconds = 0.0;	// 臒libj
+	};
+
+	// lߒ{́ibNŌĂԁj
+	size_t Compact_NoLock(uint32_t minSlots);
+
+	// N[Abv{́iCleanupIdle/CleanupIdleStep/CleanupIdleStepFrames ʁj
+	size_t CleanupIdle_Impl(const IdleLimit& limit, size_t maxSlotsPerCall, double maxMicros);
+
+	// [J[Xbhւ̐˗
+	struct BuildJob
+	{
+		uint32_t index = 0;			// i[̃Xbg
+		uint32_t generation = 0;	// ˗̐ԍiClearAll ȂǂŐił̂Ăj
+		uint32_t typeId = 0;		// ^
+		bool refill = false;		// [iҋ@ԂŊi[j AcquireAsync 
+		CreateFn create;			// ֐
+	};
+
+	// ς݂Ŋi[҂̃IuWFNg
+	struct BuiltObject
+	{
+		uint32_t index;
+		uint32_t generation;
+		uint32_t typeId;
+		bool refill;
+		std::shared_ptr<GameObject> obj; // Ɏs nullptr
+	};
+
+	// XibvVbg̎ʎqƃo[W
+	static const uint32_t SnapshotMagic = 0x4E535050; // 'PPSN'
+	static const uint32_t SnapshotVersion = 1;
+
+	// ^ʂ̕[ݒ
+	struct RefillEntry
+	{
+		size_t lowWater = 0;	// [
+		size_t target = 0;		// [̑ҋ@
+		size_t inFlight = 0;	// ̐
+		CreateFn create;		// ֐
+	};
+
+	// ^ typeId ̐p̃Xbg\񂷂iێ̋  VKXbgB̌^̑ҋ@CX^X͏㏑ȂBbNŌĂԁj
+	// i[iCommitBuilt_NoLockj܂ŐƂė\Zɐ
+	uint32_t ReservePending_NoLock(uint32_t typeId);
+
+	// IIuWFNgXbgɊi[iAdvanceFrame AbNŌĂԁj
+	void CommitBuilt_NoLock();
+
+	// [KvȌ^̐˗ibNŌĂԁj
+	void CollectRefillJobs_NoLock(std::vector<BuildJob>& jobs);
+
+	// ˗[J[Xbh֓niɃXbhNBbNOŌĂԁj
+	void PushJobs(std::vector<BuildJob>& jobs);
+
+	// [J[Xbh{
+	void WorkerLoop();
+
+	// [J[Xbh~߂ï˗͎̂Ăj
+	void StopWorker();
+
+	// ^̋󂫃XgoXbggpɂi Reset œKpĂ InitObject ĂсAJj
+	template <typename T, typename... Args>
+	TypedHandle<T> ReuseSlot_NoLock(uint32_t idx, Args&&... args)
+	{
+		Slot& s = SlotAt(idx);
+		s.inUse = true;
+		s.lastUsedFrame = m_frame;
+		s.sceneId = m_sceneArena;
+		NoteAcquired_NoLock(idx);
+		try {
+			ResetOnReuse<T>(*s.obj, std::forward<Args>(args)...);
+			s.obj->InitObject();
+		}
+		catch (...) {
+			DebugLogFmt("[ObjectPool] Exception during InitObject on reuse idx=%u\n", idx);
+		}
+		// IĂǂݎ葤֌J
+		PublishState_NoLock(s);
+		return TypedHandle<T>(idx, s.generation);
+	}
+
+	// 1Xbg̉iRelease/ReleaseN ʁAbNŌĂԁj
+	bool ReleaseSlot_NoLock(ObjectHandle handle);
+
+	// bNŐ̃IuWFNgǂݎiȂ nullptrBoutTypeId ɕێ^IDԂj
+	std::shared_ptr<GameObject> LoadLive(ObjectHandle handle, uint32_t& outTypeId) const;
+
+	// LoadLive ̐|C^Łishared_ptr Rs[Ȃj
+	GameObject* LoadLiveRaw(ObjectHandle handle, uint32_t& outTypeId) const;
+
+	// Xbg̎̂ւČ̎̂Ԃiraw 킹čXVBbNŌĂԁj
+	static std::shared_ptr<GameObject> ExchangeObject_NoLock(Slot& slot, std::shared_ptr<GameObject> obj)
+	{
+		slot.raw.store(obj.get(), std::memory_order_release);
+		return std::atomic_exchange(&slot.obj, std::move(obj));
+	}
+
+	// IuWFNg AdvanceFrame ܂ŗaibNŌĂԁj
+	void Retire_NoLock(std::shared_ptr<GameObject> obj)
+	{
+		if (obj) m_retired.push_back(std::move(obj));
+	}
+
+	// JԂnhƈv邩iEvE^^Ovj
+	static bool StateMatches(uint64_t state, ObjectHandle handle)
+	{
+		if ((state & StateLiveBit) == 0) return false;
+		if (static_cast<uint32_t>(state & ObjectHandle::GenerationMask) != handle.generation) return false;
+		if (handle.typeId != 0 && static_cast<uint32_t>((state >> 24) & 0xFFu) != handle.typeId) return false;
+		return true;
+	}
+
+	// XbǧJԂݑ̒l蒼ibNŌĂԁj
+	static void PublishState_NoLock(Slot& slot)
+	{
+		uint64_t state = (static_cast<uint64_t>(slot.typeId & 0xFFu) << 24) | (slot.generation & ObjectHandle::GenerationMask);
+		if (slot.inUse && slot.obj) state |= StateLiveBit;
+		slot.state.store(state, std::memory_order_release);
+	}
+
+	// CfbNXXbgQƂi`N͊mیɈړȂj
+	// `Ñ|C^͌JOɏ̂ŁA acquire œǂ񂾔͈͂̓bNŎQƂĂ悢
+	Slot& SlotAt(uint32_t index) { return m_chunks[index / SlotChunkSize][index % SlotChunkSize]; }
+	const Slot& SlotAt(uint32_t index) const { return m_chunks[index / SlotChunkSize][index % SlotChunkSize]; }
+
+	// Jς݂̃Xbg
+	uint32_t SlotCount() const { return m_slotCount.load(std::memory_order_acquire); }
+
+	// ɃXbgǉăCfbNXԂiKvȂ`NmہAbNŌĂԁj
+	uint32_t AppendSlot_NoLock();
+
+	// ԍi߂inh̃rbgɍ킹ďzj
+	static void AdvanceGeneration(Slot& slot) { slot.generation = (slot.generation + 1) & ObjectHandle::GenerationMask; }
+
+	// ^ʃe[u typeId ܂ŊgibNŌĂԁj
+	void EnsureTypeTables_NoLock(uint32_t typeId);
+
+	// ėpɐKpiT  Reset(Args...) ĂΌĂԁBΉȂj
+	// ^̋󂫃XgoXbgȂ̂Ŏ͕̂K T
+	template <typename T, typename... Args>
+	static void ResetOnReuse(GameObject& obj, Args&&... args)
+	{
+		ResetOnReuseImpl(static_cast<T&>(obj), ObjectPoolDetail::HasReset<T, std::tuple<Args&&...>>(), std::forward<Args>(args)...);
+	}
+
+	template <typename T, typename... Args>
+	static void ResetOnReuseImpl(T& obj, std::true_type, Args&&... args) { obj.Reset(std::forward<Args>(args)...); }
+
+	template <typename T, typename... Args>
+	static void ResetOnReuseImpl(T&, std::false_type, Args&&...) {}
+
+	// gpJEg𑝂₵AőlXVČ^ʂ̐XgɉiobjEtypeId ݒ肵AbNŌĂԁj
+	void NoteAcquired_NoLock(uint32_t index)
+	{
+		Slot& slot = SlotAt(index);
+		const uint32_t typeId = slot.typeId;
+		size_t active = ++m_activeByType[typeId];
+		if (active > m_peakByType[typeId]) m_peakByType[typeId] = active;
+
+		LiveList& live = m_liveByType[typeId];
+		slot.livePos = static_cast<uint32_t>(live.indices.size());
+		live.indices.push_back(index);
+		live.objects.push_back(slot.obj.get());
+	}
+
+	// ^ʂ̐XgOiƓւ O(1)AbNŌĂԁj
+	void RemoveLive_NoLock(uint32_t index);
+
+	// \Z̔茋
+	enum class BudgetCheck : uint8_t { Fits, OverType, OverGlobal };
+
+	// ^ typeId ̃CX^X (extra + 1) ₵Ă\Ziextra ͗\ς݂Ŗi[̐BbNŌĂԁj
+	BudgetCheck CheckBudget_NoLock(uint32_t typeId, size_t extra) const;
+
+	// ^ typeId ̃CX^X1悤ɋ󂫂iҋ@̔j  ̓BȂ falsej
+	// ߂_œ^̋󂫃XgłȂ΁AV炸ėp邱ƁibNŌĂԁBBlock ł͑҂ԃbNOj
+	bool MakeRoom_NoLock(std::unique_lock<std::mutex>& lk, uint32_t typeId, size_t extra);
+
+	// łOɉꂽҋ@CX^X1jiΎOBjłȂ falseAbNŌĂԁj
+	bool EvictLruIdle_NoLock();
+
+	// ҋ@̃Xbg̎̂Ėێ̋󂫂ֈڂiCleanupIdleE\ZɂjʁAbNŌĂԁj
+	void EvictIdleSlot_NoLock(uint32_t index);
+
+	// ^ typeId ōłOɎ擾gpCX^Xi falseAbNŌĂԁj
+	bool RecycleOldest_NoLock(uint32_t typeId);
+
+	// ^ typeId ̕ێigp + ҋ@ + j
+	size_t HeldCount_NoLock(uint32_t typeId) const { return m_activeByType[typeId] + m_freeByType[typeId].size() + m_reservedByType[typeId]; }
+
+	// 擾oH count 񕪃egɐibNŌĂԁj
+	void CountAcquire_NoLock(uint32_t typeId, AcquireSource source, size_t count);
+
+	// 擾Ԃ̌v̊JnivĂȂ OS ̎vǂ܂ɊlԂj
+	std::chrono::steady_clock::time_point LatencyStart() const
+	{
+		return m_latencyEnabled.load(std::memory_order_relaxed) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+	}
+
+	// 擾1̏vԂqXgOɋL^istart lȂ牽ȂBbNŌĂԁj
+	void RecordLatency_NoLock(uint32_t typeId, std::chrono::steady_clock::time_point start);
+
+	// ̌^̋󂫃Xbgoi falseAbNŌĂԁj
+	bool PopOtherTypeFree_NoLock(uint32_t& outIndex);
+
+	// Xbg󂫃Xg֖߂iێIuWFNg̗LŌ^ʁ^ێXgɐU蕪j
+	void PushFree_NoLock(uint32_t index);
+
+	// 󂫃Xg̖oiłȂƁj
+	uint32_t PopFree_NoLock(std::vector<uint32_t>& list);
+
+	// 󂫃Xg̓r菜iƓւ O(1)j
+	void RemoveFromFreeList_NoLock(std::vector<uint32_t>& list, uint32_t index);
+
 private:
 	mutable std::mutex m_mutex; // XbhZ[tp~[ebNX
-	std::vector<Slot> m_slots; // Xbgz
-	std::vector<uint32_t> m_freeIndices; // 󂫃XbgCfbNXXg
+	std::unique_ptr<Slot[]> m_chunks[MaxSlotChunks]; // Xbg̃`Nz
+	std::atomic<uint32_t> m_slotCount{ 0 }; // Jς݂̃Xbgiǂݎ葤͂ꖢ̂ݎQƂj
+	std::vector<std::vector<uint32_t>> m_freeByType; // ^ʂ̋󂫃XgiIuWFNgێ܂ܑҋ@̃Xbgj
+	std::vector<uint32_t> m_emptyIndices; // IuWFNgێ̋󂫃XbgXg
+	std::deque<IdleEntry> m_idleQueue; // IuWFNgێđҋ@̃Xbgij
+
+	// t[G|bNiAdvanceFrame Ői߂B݂̓bNAFramePin ̃`FbN̓bNœǂށj
+	std::atomic<uint64_t> m_frame{ 0 }; // ݂̃t[ԍ
+	std::atomic<uint64_t> m_invalidations{ 0 }; // gp̃nh𖳌ɂ񐔁iResolveStampB݂̓bNj
+	double m_frameSeconds = 0.0; // AdvanceFrame ŐώZoߕb
+	uint32_t m_sceneArena = 0; // ݊JĂV[A[ii0 Ȃ疳j
+	uint32_t m_lastSceneArena = 0; // Ōɍ̔ԂA[iID
+	std::vector<size_t> m_activeByType; // ^ʂ̎gpJEg
+	std::vector<size_t> m_reservedByType; // ^ʂ̐JEgiXbg\񂵂Ăi[܂ŁB\Zɐj
+	std::vector<size_t> m_peakByType; // ^ʂ̎gpJEg̍őliClearAll łȂj
+	std::vector<LiveList> m_liveByType; // ^ʂ̐Xg
+	std::vector<TypeStats> m_statsByType; // ^ʂ̃eg
+	std::atomic<bool> m_latencyEnabled{ false }; // 擾Ԃv邩iSetTelemetryEnabledBbNœǂށj
+	std::vector<std::shared_ptr<GameObject>> m_retired; // ㏑EjŎIuWFNgi AdvanceFrame Ŕjj
+
+	// \ZiSetTypeBudget / SetGlobalBudgetj
+	std::vector<Budget> m_typeBudgets; // ^ʂ̗\Ziݒ肳ĂȂ^͖j
+	Budget m_globalBudget; // Ŝ̗\Z
+	bool m_hasBudget = false; // ǂɗ\Zݒ肳Ă邩iΎ擾̔΂j
+	std::condition_variable m_budgetCv; // CapPolicy::Block ̑҂킹iEjŒʒmj
+	int m_budgetWaiters = 0; // ҂ĂXbhim_mutex ŕیj
+
+	// Xbg̋lߒiCompactj
+	uint64_t m_lastGrowFrame = 0; // ŌɃXbgǉt[
+	bool m_autoCompact = false; // SetAutoCompact ŗLɂ
+	uint64_t m_compactQuietFrames = 0; // ̋lߒs܂łɃXbgĂȂt[
+
+	// [J[Xbhł̐iAcquireAsync / [j
+	std::vector<BuiltObject> m_built; // ς݂Ŋi[҂im_mutex ŕیj
+	std::vector<RefillEntry> m_refill; // ^ʂ̕[ݒim_mutex ŕیj
+	std::thread m_worker; // [J[Xbhiŏ̈˗ŋNj
+	std::mutex m_jobMutex; // ˗L[p~[ebNXim_mutex ƓɎƂ m_mutex Ɏj
+	std::condition_variable m_jobCv; // ˗̒ʒm
+	std::deque<BuildJob> m_jobs; // ̈˗
+	bool m_workerStop = false; // [J[Xbh̒~vim_jobMutex ŕیj
 
 	// Vbg_E^ANeBuǗ
 	std::atomic<bool> m_shuttingDown{ false };
-	std::atomic<int> m_activeOps{0 };
+	std::atomic<int> m_activeOps{ 0 };
 
 	//܂łɐꂽIuWFNgi݌vj
 	size_t m_totalCreated =0;
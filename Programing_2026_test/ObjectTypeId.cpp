@@ -0,0 +1,41 @@
+#include "ObjectTypeId.h"
+#include "Assert.h"
+#include <atomic>
+
+namespace
+{
+	std::atomic<uint32_t> s_counter{ 0 };						// ̔ԍς݂̍őID
+	std::atomic<const char*> s_names[ObjectTypeId::MaxTypeId + 1];	// ^IDƂ̌^
+	std::atomic<size_t> s_sizes[ObjectTypeId::MaxTypeId + 1];		// ^IDƂ sizeof
+}
+
+// ^ID̍̔ԁi1 珇Ɋ蓖Ăj
+uint32_t ObjectTypeId::Next(const char* name, size_t size) noexcept
+{
+	uint32_t id = s_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+	ASSERT_MSG(id <= MaxTypeId, "ObjectTypeId: too many object types");
+	if (id <= MaxTypeId) {
+		s_sizes[id].store(size, std::memory_order_relaxed);
+		s_names[id].store(name, std::memory_order_release);
+	}
+	return id;
+}
+
+const char* ObjectTypeId::NameOf(uint32_t id) noexcept
+{
+	if (id == 0 || id > MaxTypeId) return "";
+	const char* name = s_names[id].load(std::memory_order_acquire);
+	return name ? name : "";
+}
+
+size_t ObjectTypeId::SizeOf(uint32_t id) noexcept
+{
+	if (id == 0 || id > MaxTypeId) return 0;
+	return s_sizes[id].load(std::memory_order_relaxed);
+}
+
+uint32_t ObjectTypeId::Count() noexcept
+{
+	uint32_t count = s_counter.load(std::memory_order_relaxed);
+	return count < MaxTypeId ? count : MaxTypeId;
+}
\ No newline at end of file
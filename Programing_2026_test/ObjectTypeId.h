@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <typeinfo>
+
+// ^Ƃ̏ȐIDiv[̌^ʊǗpj
+// 0 ́u^Ȃi󂫃XbgjvƂė\񂵂Ă
+namespace ObjectTypeId
+{
+	// o^ł^ID̍őlinhւ̃pbNl 8bit Ɏ߂j
+	const uint32_t MaxTypeId = 255;
+
+	// V^ID̔ԂA^itypeid  namej sizeof L^i cpp j
+	uint32_t Next(const char* name, size_t size) noexcept;
+
+	// ^ID^擾io^Ȃ󕶎Bvt@CۑȂǂŌ^ʂ̂Ɏgj
+	const char* NameOf(uint32_t id) noexcept;
+
+	// ^ID sizeof 擾io^Ȃ 0Bv[̃oCg̗\ZɎgj
+	size_t SizeOf(uint32_t id) noexcept;
+
+	// ̔ԍς݂̌^ID̍ől
+	uint32_t Count() noexcept;
+
+	// ^ T  ID 擾iĂяoɍ̔ԂAȍ~͓lԂj
+	template <typename T>
+	uint32_t Of() noexcept
+	{
+		static const uint32_t id = Next(typeid(T).name(), sizeof(T));
+		return id;
+	}
+}
\ No newline at end of file
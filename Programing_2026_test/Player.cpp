@@ -30,11 +30,28 @@ Player::~Player()
 	m_bulletTrigger.Clear();	// Release Ǘ End()ōsÔ
 }
 
+// v[ėp̈ēKp
+void Player::Reset(const std::weak_ptr<SceneBase> scene, VECTOR position, float objectRadiusSize)
+{
+	m_scene = scene;
+	m_isActive = true;
+	m_life = 100.0f;
+	m_fireTimer = 0.0f;
+	m_objectRadiusSize = objectRadiusSize;
+
+	m_transform->SetPosition(position);
+	m_transform->SetRotation({0.0f,0.0f,0.0f });
+	m_transform->SetScale({1.0f,1.0f,1.0f });
+
+	TriangleBaseInitUsingTransform(m_objectRadiusSize,270.0f);
+}
+
 // tbNiɌĂтhNXŎj
 void Player::InitObject()
 {
 	// RXgN^ړ
 	m_bulletTrigger.SetOwnerObject(shared_from_this());
+	m_bulletColor = GetColor(0, 255, 125); // RXgN^̓[J[XbhœƂ̂ŁADxLib ͂ŌĂ
 
 	// Op`̏i傫20j
 	TriangleBaseInitUsingTransform(20.0f);
@@ -242,3 +259,29 @@ void Player::Defend()
 {
 	//ɖh䏈
 }
+
+
+// XibvVbg
+void Player::Serialize(SnapshotWriter& out) const
+{
+	GameObject::Serialize(out);
+	out.Write(m_moveSpeed);
+	out.Write(m_life);
+	out.Write(m_objectRadiusSize);
+	out.Write(m_fireTimer);
+	out.Write(m_collider.IsActive());
+	m_ChildObjectGroup.Serialize(out);
+	m_bulletTrigger.Serialize(out);
+}
+
+bool Player::Deserialize(SnapshotReader& in)
+{
+	bool colActive = false;
+	if (!GameObject::Deserialize(in)) return false;
+	if (!(in.Read(m_moveSpeed) && in.Read(m_life) && in.Read(m_objectRadiusSize) && in.Read(m_fireTimer) && in.Read(colActive))) return false;
+	if (!m_ChildObjectGroup.Deserialize(in) || !m_bulletTrigger.Deserialize(in)) return false;
+
+	m_collider.SetActive(colActive);
+	TriangleBaseInitUsingTransform(m_objectRadiusSize, 270.0f);
+	return true;
+}
\ No newline at end of file
@@ -27,7 +27,7 @@ private:
 	float m_bulletRadius = 3.0f;	// e̔a (px/scale=1)
 	float m_bulletSpeed = 300.0f;	// ȇx (px/sec)
 	float m_bulletLife = 10.0f;		// e̎ (b)
-	unsigned int m_bulletColor = GetColor(0, 255, 125); // e̐F: 
+	unsigned int m_bulletColor = 0; // e̐F: ΁iDxLib ĂԂ̂ InitObject Őݒ肷j
 
 	// 蔻p
 	TriangleCollider m_collider; // g̃RC_[
@@ -37,6 +37,9 @@ public:
 	Player(const std::weak_ptr<SceneBase> scene, VECTOR position, float objectRadiusSize);
 	virtual ~Player();
 
+	// v[ėpɐKpiRXgN^Ɠj
+	void Reset(const std::weak_ptr<SceneBase> scene, VECTOR position, float objectRadiusSize);
+
 	// GameObject CtTCN
 	void InitObject() override;	// ǉ: tbNiɌĂтhNXŎj
 	void Start() override;		// ŏɈ񂾂Ă΂
@@ -44,6 +47,10 @@ public:
 	void Draw() override;		// t[Ă΂i`pj
 	void End() override;        // V[폜ƂɈ񂾂Ă΂
 
+	// XibvVbg
+	void Serialize(SnapshotWriter& out) const override;
+	bool Deserialize(SnapshotReader& in) override;
+
 private:
 	// ړ(Class)
 	void Move();
@@ -0,0 +1,193 @@
+#include "PoolBenchmark.h"
+#include "ObjectManager.h"
+#include "ObjectGroup.h"
+#include "Bullet.h"
+#include "DxLib.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	const size_t BulletCount = 10000;	// ẽs[N̒e
+	const size_t BurstCount = 64;		// 1t[ł܂Ƃ߂Čeie1񕪁j
+	const int Rounds = 50;				// 1̌vJԂ񐔁iŏl̂j
+
+	volatile float g_sink = 0.0f; // vvZœKŏȂ悤Ɍʂސ
+
+	// setup()ivȂj f()ivj Rounds JԂAf() 1̍ŏԂimbŕԂ
+	template <typename Setup, typename F>
+	double MinNs(Setup&& setup, F&& f)
+	{
+		double best = 0.0;
+		for (int r = 0; r < Rounds; ++r)
+		{
+			setup();
+			const auto start = Clock::now();
+			f();
+			const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			if (r == 0 || ns < best) best = ns;
+		}
+		return best;
+	}
+}
+
+bool PoolBenchmark::Run(const std::string& path)
+{
+	std::vector<Result> results;
+	IterateBullets(results);
+	BurstCreateRelease(results);
+	ReleaseThroughput(results);
+
+	std::ofstream out(path, std::ios::trunc);
+	if (!out) return false;
+	out << "benchmark,count,ns_per_object\n";
+	for (const Result& r : results)
+	{
+		out << r.name << ',' << r.count << ',' << r.nsPerObject << "\n";
+
+		char buf[256];
+		sprintf_s(buf, "[PoolBenchmark] %s count=%zu %.2f ns/object\n", r.name.c_str(), r.count, r.nsPerObject);
+		OutputDebugStringA(buf);
+	}
+	return static_cast<bool>(out);
+}
+
+// e 10000 ̑
+// eIuWFNgœyixxNg̓ǂݏojsÂ̂ɂ鎞Ԃׂ
+void PoolBenchmark::IterateBullets(std::vector<Result>& results)
+{
+	auto& mgr = ObjectManager::GetInstance();
+
+	std::vector<ObjectHandle> handles(BulletCount);
+	handles.resize(mgr.CreateN<Bullet>(BulletCount, handles.data(), std::weak_ptr<SceneBase>(), VGet(0.0f, 0.0f, 0.0f), 8.0f));
+
+	ObjectGroup group;
+	for (ObjectHandle h : handles) group.Add(h);
+
+	// O[v̉ʂ1t[̊Ԏg񂷂̂ŁAt[i߂Ďۂ̃t[Ɠ蒼
+	const auto nextFrame = [&mgr] { mgr.AdvanceFrame(0.0); };
+	float sum = 0.0f;
+
+	// ^ʂ̐Xg𒼐ډ񂷁inhȂj
+	const double live = MinNs(nextFrame, [&] {
+		mgr.ForEachLive<Bullet>([&sum](Bullet& b) { sum += b.GetVelocity().x; });
+	});
+
+	// O[v̑it[Ƃɂ܂Ƃ߂ĉ|C^񂷁j
+	const double grouped = MinNs(nextFrame, [&] {
+		group.ForEach([&sum](GameObject& obj) { sum += static_cast<Bullet&>(obj).GetVelocity().x; });
+	});
+
+	// nhƂ Get ŉishared_ptr ̃Rs[BO[vgȂꍇ̏j
+	const double perHandle = MinNs(nextFrame, [&] {
+		for (ObjectHandle h : handles) {
+			if (auto b = mgr.Get<Bullet>(h)) sum += b->GetVelocity().x;
+		}
+	});
+	g_sink = sum;
+
+	const double n = static_cast<double>(handles.size());
+	results.push_back(Result{ "iterate_ForEachLive", handles.size(), live / n });
+	results.push_back(Result{ "iterate_ObjectGroup_ForEach", handles.size(), grouped / n });
+	results.push_back(Result{ "iterate_Get_per_handle", handles.size(), perHandle / n });
+
+	// e̓v[֖߂iҋ@ƂĎĉŁAȍ~̌vłėpj
+	group.Clear();
+	mgr.AdvanceFrame(0.0);
+}
+
+// e1񕪁i64 j̐Ɖ: CreateN / ReleaseN ƁACreate / Release Ăԏꍇׂ
+// v[ɑҋ@̒eԁie2ڈȍ~jő̂ŁA͍ėp̌oHɂȂ
+// P̂ Release ̓fobOO𖈉oA1Ăԏꍇ̎ۂ̃RXgƂĊ܂߂Ă
+void PoolBenchmark::BurstCreateRelease(std::vector<Result>& results)
+{
+	auto& mgr = ObjectManager::GetInstance();
+
+	std::vector<ObjectHandle> handles(BurstCount);
+	const std::weak_ptr<SceneBase> noScene;
+	const VECTOR origin = VGet(0.0f, 0.0f, 0.0f);
+	const float radius = 8.0f;
+
+	// vȂ̉iς݁Eȃnh ReleaseN j
+	const auto releaseAll = [&] {
+		mgr.ReleaseN(handles.data(), handles.size());
+		mgr.AdvanceFrame(0.0);
+	};
+	const auto createAll = [&] { mgr.CreateN<Bullet>(handles.size(), handles.data(), noScene, origin, radius); };
+
+	const double createSingle = MinNs(releaseAll, [&] {
+		for (ObjectHandle& h : handles) h = mgr.Create<Bullet>(noScene, origin, radius);
+	});
+	releaseAll();
+
+	const double createBatch = MinNs(releaseAll, createAll);
+	releaseAll();
+
+	const double releaseSingle = MinNs(createAll, [&] {
+		for (ObjectHandle h : handles) mgr.Release(h);
+	});
+	const double releaseBatch = MinNs(createAll, [&] { mgr.ReleaseN(handles.data(), handles.size()); });
+	mgr.AdvanceFrame(0.0);
+
+	const double n = static_cast<double>(handles.size());
+	results.push_back(Result{ "create_single", handles.size(), createSingle / n });
+	results.push_back(Result{ "create_CreateN", handles.size(), createBatch / n });
+	results.push_back(Result{ "release_single", handles.size(), releaseSingle / n });
+	results.push_back(Result{ "release_ReleaseN", handles.size(), releaseBatch / n });
+}
+
+// e 10000 ̉X[vbgi󂫃Xg 0  10000 ܂ŐLтĂԂ̉j
+// 󂫃Xgւ̏dǉ̊mF́AȑO std::find ŋ󂫃Xg𑖍Ăiɔj
+// ̊mF𓯂EōČ̂ƁÃXbg̈ʒuifreeListPosjɂmFׂ
+// Č2s͊mF̔rŁAŜ̎Ԃ release_all_ReleaseN ̍s
+void PoolBenchmark::ReleaseThroughput(std::vector<Result>& results)
+{
+	auto& mgr = ObjectManager::GetInstance();
+
+	// ҋ@̒e͐Ŏg؂̂ŁÂтɌ^ʂ̋󂫃Xg 0 LтĂ
+	std::vector<ObjectHandle> handles(BulletCount);
+	const auto createAll = [&] {
+		mgr.AdvanceFrame(0.0);
+		mgr.CreateN<Bullet>(handles.size(), handles.data(), std::weak_ptr<SceneBase>(), VGet(0.0f, 0.0f, 0.0f), 8.0f);
+	};
+	const double releaseAll = MinNs(createAll, [&] { mgr.ReleaseN(handles.data(), handles.size()); });
+	mgr.AdvanceFrame(0.0);
+
+	// mF̍ČiXbgԍ̕т̓v[ł̉Ɠj
+	const uint32_t NotInList = 0xFFFFFFFFu;
+	uint32_t maxIndex = 0;
+	for (ObjectHandle h : handles) maxIndex = (std::max)(maxIndex, h.index);
+
+	std::vector<uint32_t> freeList;
+	std::vector<uint32_t> freeListPos(maxIndex + 1, NotInList);
+	const auto clearList = [&] {
+		freeList.clear();
+		std::fill(freeListPos.begin(), freeListPos.end(), NotInList);
+	};
+
+	// : 󂫃Xg std::find őĂǉ
+	const double findCheck = MinNs(clearList, [&] {
+		for (ObjectHandle h : handles) {
+			if (std::find(freeList.begin(), freeList.end(), h.index) == freeList.end()) freeList.push_back(h.index);
+		}
+	});
+
+	// V: XbgɎ󂫃Xg̈ʒuŔ肵Ăǉ
+	const double posCheck = MinNs(clearList, [&] {
+		for (ObjectHandle h : handles) {
+			if (freeListPos[h.index] == NotInList) {
+				freeListPos[h.index] = static_cast<uint32_t>(freeList.size());
+				freeList.push_back(h.index);
+			}
+		}
+	});
+	g_sink = static_cast<float>(freeList.size());
+
+	const double n = static_cast<double>(handles.size());
+	results.push_back(Result{ "release_all_ReleaseN", handles.size(), releaseAll / n });
+	results.push_back(Result{ "release_check_old_std_find", handles.size(), findCheck / n });
+	results.push_back(Result{ "release_check_freeListPos", handles.size(), posCheck / n });
+}
\ No newline at end of file
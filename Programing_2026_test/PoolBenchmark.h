@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// IuWFNgv[̐\viPOOL_BENCHMARK `rhŁAMain Q[̑ɌĂԁj
+// ʂ CSVibenchmark,count,ns_per_objectjɏoAfobOo͂ɂo
+// v[̃Oo͂AT[gŐl傫ς̂ŁA[XrhfobKŎsČv邱
+class PoolBenchmark
+{
+public:
+	// SĂ̌vsAʂ path ɏoioȂ falsej
+	static bool Run(const std::string& path);
+
+private:
+	// v1
+	struct Result
+	{
+		std::string name;	// v
+		size_t count;		// 1̌vňIuWFNg
+		double nsPerObject;	// IuWFNg1̎ԁiimbBJԂ̍ŏlj
+	};
+
+	// e 10000 ̑: ForEachLive<Bullet>  ObjectGroup::ForEachiƁAnhƂ Getjׂ
+	static void IterateBullets(std::vector<Result>& results);
+
+	// e 64 ̐E: CreateN / ReleaseN ƁACreate / Release  64 Ăԏꍇׂ
+	static void BurstCreateRelease(std::vector<Result>& results);
+
+	// e 10000 ̉X[vbg: 󂫃Xg̏dmFAȑO std::find ɂ鑖ƍ freeListPos Ŕׂ
+	static void ReleaseThroughput(std::vector<Result>& results);
+};
\ No newline at end of file
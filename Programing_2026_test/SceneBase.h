@@ -8,7 +8,7 @@ class SceneBase
 	: public KeyInput, public std::enable_shared_from_this<SceneBase> // V[g shared_ptr 擾\ɂ	
 {
 public:
-	SceneBase() {}
+	SceneBase() : m_objects(ObjectGroup::Order::Stable) {} // V[̃IuWFNg͕`揇ۂ
 	virtual ~SceneBase() {}
 
 public:
@@ -28,6 +28,10 @@ public:
 	// ݃ANeBuȃV[̎QƂ擾
 	static std::weak_ptr<SceneBase> GetCurrentSceneWeak();
 
+	// XibvVbg: V[̃IuWFNgO[ṽnhꗗiObjectManager::Snapshot / Restore Ăԁj
+	void SerializeObjects(SnapshotWriter& out) const { m_objects.Serialize(out); }
+	bool DeserializeObjects(SnapshotReader& in) { return m_objects.Deserialize(in); }
+
 protected:
 	// V[̃IuWFNgǗp
 	ObjectGroup m_objects; // IuWFNgO[v
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+
+// XibvVbgiObjectManager::Snapshot/Restorejp̃oCi
+// l̓̕\̂܂܏irhEvZXł̕ۑƕOɂĂj
+class SnapshotWriter
+{
+public:
+	explicit SnapshotWriter(std::vector<uint8_t>& buffer) : m_buffer(buffer) {}
+
+	// l1ށi|C^ std::string ȂǁÂ܂܃Rs[łȂ^͕sj
+	template <typename T>
+	void Write(const T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "SnapshotWriter: T must be trivially copyable");
+		WriteBytes(&value, sizeof(T));
+	}
+
+	// oCg
+	void WriteBytes(const void* data, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+	}
+
+	// ݍς݂̈ʒuɒl߂iォ猈܂TCYȂǂɎgj
+	template <typename T>
+	void WriteAt(size_t offset, const T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "SnapshotWriter: T must be trivially copyable");
+		std::memcpy(&m_buffer[offset], &value, sizeof(T));
+	}
+
+	// ݂݈̏ʒu
+	size_t Size() const { return m_buffer.size(); }
+
+private:
+	std::vector<uint8_t>& m_buffer;
+};
+
+// XibvVbgp̃oCiǂݍ
+// ͈͊OǂƂ玸sԂɂȂAȍ~ Read ׂ͂ false Ԃ
+class SnapshotReader
+{
+public:
+	SnapshotReader(const uint8_t* data, size_t size) : m_cur(data), m_end(data + size) {}
+
+	// l1ǂݍ
+	template <typename T>
+	bool Read(T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "SnapshotReader: T must be trivially copyable");
+		const uint8_t* bytes = ReadBytes(sizeof(T));
+		if (!bytes) return false;
+		std::memcpy(&value, bytes, sizeof(T));
+		return true;
+	}
+
+	// size oCgǂݐi߂Đ擪ԂiȂ nullptrj
+	const uint8_t* ReadBytes(size_t size)
+	{
+		if (m_failed || static_cast<size_t>(m_end - m_cur) < size) {
+			m_failed = true;
+			return nullptr;
+		}
+		const uint8_t* bytes = m_cur;
+		m_cur += size;
+		return bytes;
+	}
+
+	size_t Remaining() const { return static_cast<size_t>(m_end - m_cur); } // c̃oCg
+	bool Failed() const { return m_failed; } // ͈͊OǂƂ
+
+private:
+	const uint8_t* m_cur;
+	const uint8_t* m_end;
+	bool m_failed = false;
+};
\ No newline at end of file
@@ -32,10 +32,27 @@ Triangles::~Triangles()
 	m_bulletTrigger.Clear();
 }
 
+// プール再利用時の引数再適用
+void Triangles::Reset(const std::weak_ptr<SceneBase> scene, VECTOR position, float objectRadiusSize)
+{
+	m_scene = scene;
+	m_isActive = true;
+	m_objectRadiusSize = objectRadiusSize;
+	m_moveDir = 1;
+	m_fireTimer = 0.0f;
+
+	m_transform->SetPosition(position);
+	m_transform->SetRotation({ 0.0f, 0.0f, 0.0f });
+	m_transform->SetScale({ 1.0f, 1.0f, 1.0f });
+
+	TriangleBaseInitUsingTransform(m_objectRadiusSize, 90.0f);
+}
+
 // 生成直後(Factory)に呼ぶ初期化
 void Triangles::InitObject()
 {
 	// 再利用時の初期化などがあればここに
+	m_bulletColor = GetColor(255, 0, 0); // コンストラクタはワーカースレッドで動くことがあるので、DxLib はここで呼ぶ
 	TriangleBaseInitUsingTransform(m_objectRadiusSize);
 
 	// コライダー初期化
@@ -205,4 +222,37 @@ void Triangles::OnHit(Collider* other)
 {
 	m_life -= 10.0f; // 10ダメージ
 	// プレイヤーの弾に当たった場合はダメージ処理など
+}
+
+// スナップショット
+void Triangles::Serialize(SnapshotWriter& out) const
+{
+	GameObject::Serialize(out);
+	out.Write(m_objectRadiusSize);
+	out.Write(m_life);
+	out.Write(m_moveDir);
+	out.Write(m_moveSpeed);
+	out.Write(m_fireTimer);
+	out.Write(m_collider.IsActive());
+	m_ChildObjectGroup.Serialize(out);
+	m_bulletTrigger.Serialize(out);
+}
+
+bool Triangles::Deserialize(SnapshotReader& in)
+{
+	bool colActive = false;
+	if (!GameObject::Deserialize(in)) return false;
+	if (!(in.Read(m_objectRadiusSize) && in.Read(m_life) && in.Read(m_moveDir) && in.Read(m_moveSpeed)
+		&& in.Read(m_fireTimer) && in.Read(colActive))) return false;
+	if (!m_ChildObjectGroup.Deserialize(in) || !m_bulletTrigger.Deserialize(in)) return false;
+
+	// 子が作り直されていても親子付けが戻るように、復元したハンドルから付け直す
+	// （復元中は全スロットが公開済みなので、子の Deserialize より先でもハンドルは有効）
+	m_ChildObjectGroup.ForEach([this](ChildTriangles& child) {
+		child.GetTransform()->SetParent(m_transform);
+	});
+
+	m_collider.SetActive(colActive);
+	TriangleBaseInitUsingTransform(m_objectRadiusSize, 90.0f);
+	return true;
 }
\ No newline at end of file
@@ -1,12 +1,13 @@
 // GP(Triangles) 
 #pragma once
 #include "TriangleBase.h"
-#include "ObjectGroup.h"
+#include "TypedObjectGroup.h"
 #include "KeyInput.h"
 #include "BulletTrigger.h" 
 #include "TriangleCollider.h"
 #include <memory>
 
+class ChildTriangles;
 
 class Triangles
 	: public TriangleBase, public KeyInput
@@ -21,7 +22,7 @@ private:
 	int m_moveSpeed = 100; // ړx
 
 	// Childpϐ
-	ObjectGroup m_ChildObjectGroup;
+	TypedObjectGroup<ChildTriangles> m_ChildObjectGroup; // q ChildTriangles 
 	float m_childObjectRadius = 30.0f;	// qIuWFNg̔a
 	float m_childOffsetSize = 80.0f;	// qIuWFNg̃ItZbg̑傫
 
@@ -32,7 +33,7 @@ private:
 	float m_bulletRadius = 3.0f;	// e̔a (px/scale=1)
 	float m_bulletSpeed = 100.0f;	// ȇx (px/sec)
 	float m_bulletLife = 10.0f;		// e̎ (b)
-	unsigned int m_bulletColor = GetColor(255, 0, 0); // e̐F
+	unsigned int m_bulletColor = 0; // e̐F(ԁBDxLib ĂԂ̂ InitObject Őݒ肷)
 
 	// 蔻p
 	TriangleCollider m_collider;
@@ -41,6 +42,9 @@ public:
 	Triangles(const std::weak_ptr<SceneBase> scene, VECTOR position, float objectRadiusSize);
 	virtual ~Triangles();
 
+	// v[ėpɐKpiRXgN^Ɠj
+	void Reset(const std::weak_ptr<SceneBase> scene, VECTOR position, float objectRadiusSize);
+
 public:
 	void InitObject() override;	// tbNiɌĂтhNXŎj
 	void Start() override;		// ŏɈ񂾂Ă΂
@@ -48,6 +52,10 @@ public:
 	void Draw() override;		// t[Ă΂i`pj
 	void End() override;        // V[폜ƂɈ񂾂Ă΂
 
+	// XibvVbg
+	void Serialize(SnapshotWriter& out) const override;
+	bool Deserialize(SnapshotReader& in) override;
+
 private:
 	void Move(); // ړ(Class)
 
@@ -0,0 +1,81 @@
+#pragma once
+#include "ObjectGroup.h"
+#include "ObjectHandle.h"
+#include "ObjectTypeId.h"
+#include <type_traits>
+#include <utility>
+
+// 1ނ̌^ T ȂO[viBulletTrigger  BulletATriangles  ChildTriangles Ȃǁj
+// T  final ɌiT ^Ƃ Update / Draw ĂԂ̂ŁARpCzĂяoOăCCWJłj
+// nh̊Ǘiۗ̕EWEꊇj ObjectGroup ̂܂܎g
+// gEĂԏԂ ObjectGroup ƓiRemoveAllChild EndAll Clearj
+template <typename T>
+class TypedObjectGroup
+{
+public:
+	explicit TypedObjectGroup(ObjectGroup::Order order = ObjectGroup::Order::Unordered) : m_group(order) {}
+
+	// nhǉinh͖B^tnh󂯎Ȃj
+	void Add(TypedHandle<T> h) { m_group.Add(h); }
+
+	// nh폜i݂΁j
+	void Remove(TypedHandle<T> h) { m_group.Remove(h); }
+
+	// SNA
+	void Clear() { m_group.Clear(); }
+
+	// SIuWFNg Updateiς݂̃nh̓Xg폜j
+	void UpdateAll()
+	{
+		// o[ƂĎł T O錾̂Ƃ̂ŁAĂяỏ邱Ŋm߂
+		static_assert(std::is_final<T>::value, "TypedObjectGroup<T> requires T to be final");
+		m_group.StartCommitted(); // ҂Œǉ̂́Ai[̍ŏ UpdateAll  Start Ă
+		m_group.VisitResolved([](ObjectHandle, GameObject& obj) {
+			static_cast<T&>(obj).Update(); // T  final Ȃ̂ŉzĂяoɂȂȂ
+		});
+	}
+
+	// SIuWFNg Drawiς݂̃nh̓Xg폜j
+	void DrawAll()
+	{
+		static_assert(std::is_final<T>::value, "TypedObjectGroup<T> requires T to be final");
+		m_group.VisitResolved([](ObjectHandle, GameObject& obj) {
+			static_cast<T&>(obj).Draw();
+		});
+	}
+
+	// SIuWFNg End
+	void EndAll() { m_group.EndAll(); }
+
+	// qIuWFNg폜
+	void RemoveAllChild() { m_group.RemoveAllChild(); }
+
+	// Cӂ̑eIuWFNgɑ΂čsif(T&)BQƃJEg͕ςȂj
+	template <typename F>
+	void ForEach(F&& f)
+	{
+		m_group.VisitResolved([&f](ObjectHandle, GameObject& obj) {
+			f(static_cast<T&>(obj));
+		});
+	}
+
+	// pred(T&)  true ɂȂIuWFNg1ł邩i_ő߂j
+	template <typename Pred>
+	bool AnyOf(Pred&& pred) { return FindIf(std::forward<Pred>(pred)).IsValid(); }
+
+	// pred(T&)  true ɂȂŏ̃IuWFNg̃nhiΖnhB_ő߂j
+	template <typename Pred>
+	TypedHandle<T> FindIf(Pred&& pred)
+	{
+		return TypedHandle<T>(m_group.VisitResolvedUntil([&pred](ObjectHandle, GameObject& obj) {
+			return static_cast<bool>(pred(static_cast<T&>(obj)));
+		}));
+	}
+
+	// XibvVbgiǂݖ߂ł T ȊǑ^^ÕnhĂ玸sj
+	void Serialize(SnapshotWriter& out) const { m_group.Serialize(out); }
+	bool Deserialize(SnapshotReader& in) { return m_group.Deserialize(in, ObjectTypeId::Of<T>()); }
+
+private:
+	ObjectGroup m_group; // g͌^Ȃ̃O[vinh Add ̌^ T Ɍj
+};
\ No newline at end of file